@@ -0,0 +1,1161 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_as5600_api_benchmark.c
+ * @brief     driver as5600 api benchmark source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-09-30
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/09/30  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "driver_as5600.h"
+#include "driver_as5600_sim.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief benchmark array length definition
+ */
+#define BENCHMARK_ARRAY_LEN 64        /**< samples per array call */
+
+/**
+ * @brief benchmark case structure definition
+ */
+typedef struct benchmark_case_s
+{
+    const char *name;                       /**< case name */
+    void (*setup)(void);                    /**< setup function or NULL */
+    uint8_t (*run)(uint32_t i);             /**< timed function, i is the iteration */
+    void (*teardown)(void);                 /**< teardown function or NULL */
+} benchmark_case_t;
+
+static as5600_handle_t gs_handle;                           /**< as5600 handle */
+static as5600_sim_t gs_sim;                                 /**< simulated device */
+static uint16_t gs_reg[BENCHMARK_ARRAY_LEN];                /**< array input */
+static int32_t gs_fixed[BENCHMARK_ARRAY_LEN];               /**< array output */
+static int64_t gs_position[BENCHMARK_ARRAY_LEN];            /**< unwrapped array output */
+static uint16_t gs_last_raw;                                /**< unwrap chain raw data */
+static int64_t gs_last_position;                            /**< unwrap chain position */
+#if (AS5600_FLOAT_ENABLE == 1)
+static float gs_float[BENCHMARK_ARRAY_LEN];                 /**< array output */
+#endif
+static as5600_sim_timing_t gs_timing[3];                    /**< 100kHz, 400kHz and 1MHz bus timings */
+static as5600_sample_t gs_ring_buf[8];                      /**< ring buffer */
+static as5600_ring_t gs_ring;                               /**< sample ring */
+static uint8_t gs_frame[AS5600_STREAM_FRAME_SIZE];          /**< stream frame */
+static volatile uint32_t gs_sink;                           /**< result sink */
+
+/**
+ * @brief     benchmark delay
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_benchmark_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     benchmark print
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_benchmark_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vprintf(fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_benchmark_now_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  benchmark timestamp
+ * @return time in us
+ * @note   none
+ */
+static uint32_t a_benchmark_timestamp_us(void)
+{
+    return (uint32_t)(a_benchmark_now_ns() / 1000);
+}
+
+/**
+ * @brief     benchmark async read, completed before it returns
+ * @param[in] *user_data pointer to the simulated device
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] *done pointer to a completion function
+ * @param[in] *ctx pointer to a completion context
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_benchmark_iic_read_async(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                          void (*done)(void *ctx, uint8_t res), void *ctx)
+{
+    done(ctx, as5600_sim_iic_read(user_data, addr, reg, buf, len));
+    
+    return 0;
+}
+
+/**
+ * @brief benchmark setup and teardown functions
+ */
+static void a_benchmark_shadow_on(void)
+{
+    (void)as5600_set_shadow_cache(&gs_handle, AS5600_BOOL_TRUE);
+    (void)as5600_shadow_cache_refresh(&gs_handle);
+}
+
+static void a_benchmark_shadow_off(void)
+{
+    (void)as5600_set_shadow_cache(&gs_handle, AS5600_BOOL_FALSE);
+}
+
+static void a_benchmark_reinit(void)
+{
+    (void)as5600_init(&gs_handle);
+}
+
+static void a_benchmark_poll_on(void)
+{
+    (void)as5600_start_poll_read(&gs_handle, AS5600_POLL_REGISTER_RAW_ANGLE);
+}
+
+static void a_benchmark_poll_off(void)
+{
+    (void)as5600_stop_poll_read(&gs_handle);
+}
+
+static void a_benchmark_multi_turn_on(void)
+{
+    (void)as5600_multi_turn_init(&gs_handle, 1024);
+}
+
+static void a_benchmark_range_on(void)
+{
+    (void)as5600_range_load(&gs_handle);
+}
+
+static void a_benchmark_verify_on(void)
+{
+    (void)as5600_set_verify(&gs_handle, AS5600_BOOL_TRUE);
+}
+
+static void a_benchmark_ring_on(void)
+{
+    (void)as5600_ring_init(&gs_ring, gs_ring_buf, 8);
+}
+
+static void a_benchmark_frame_on(void)
+{
+    as5600_sample_t sample;
+    
+    sample.timestamp_us = 0x89ABCDEF;
+    sample.raw_angle = 0xABC;
+    sample.status = AS5600_STATUS_MD;
+    sample.sequence = 0;
+    (void)as5600_stream_encode(&sample, 0x1234, gs_frame);
+}
+
+/**
+ * @brief benchmark timed functions
+ */
+static uint8_t a_benchmark_info(uint32_t i)
+{
+    as5600_info_t info;
+    
+    (void)i;
+    
+    return as5600_info(&info);
+}
+
+static uint8_t a_benchmark_init_deinit(uint32_t i)
+{
+    (void)i;
+    if (as5600_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    return as5600_deinit(&gs_handle);
+}
+
+#if (AS5600_FLOAT_ENABLE == 1)
+static uint8_t a_benchmark_read(uint32_t i)
+{
+    uint16_t raw;
+    float deg;
+    
+    (void)i;
+    
+    return as5600_read(&gs_handle, &raw, &deg);
+}
+
+static uint8_t a_benchmark_angle_convert_to_register(uint32_t i)
+{
+    uint16_t reg;
+    uint8_t res;
+    
+    res = as5600_angle_convert_to_register(&gs_handle, (float)(i % 360), &reg);
+    gs_sink = reg;
+    
+    return res;
+}
+
+static uint8_t a_benchmark_angle_convert_to_data(uint32_t i)
+{
+    float deg;
+    uint8_t res;
+    
+    res = as5600_angle_convert_to_data(&gs_handle, (uint16_t)(i & 0xFFF), &deg);
+    gs_sink = (uint32_t)deg;
+    
+    return res;
+}
+
+static uint8_t a_benchmark_angle_convert_to_data_array(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_angle_convert_to_data_array(&gs_handle, gs_reg, gs_float, BENCHMARK_ARRAY_LEN);
+}
+
+static uint8_t a_benchmark_angle_convert_to_rad_array(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_angle_convert_to_rad_array(&gs_handle, gs_reg, gs_float, BENCHMARK_ARRAY_LEN);
+}
+#endif
+
+static uint8_t a_benchmark_read_fixed(uint32_t i)
+{
+    uint16_t raw;
+    int32_t angle;
+    
+    (void)i;
+    
+    return as5600_read_fixed(&gs_handle, AS5600_FIXED_FORMAT_DEG_Q16, &raw, &angle);
+}
+
+static uint8_t a_benchmark_angle_convert_from_fixed(uint32_t i)
+{
+    uint16_t reg;
+    uint8_t res;
+    
+    res = as5600_angle_convert_from_fixed(&gs_handle, AS5600_FIXED_FORMAT_BAM16, (int32_t)(i & 0xFFFF), &reg);
+    gs_sink = reg;
+    
+    return res;
+}
+
+static uint8_t a_benchmark_angle_convert_to_fixed(uint32_t i)
+{
+    int32_t angle;
+    uint8_t res;
+    
+    res = as5600_angle_convert_to_fixed(&gs_handle, AS5600_FIXED_FORMAT_DEG_Q16, (uint16_t)(i & 0xFFF), &angle);
+    gs_sink = (uint32_t)angle;
+    
+    return res;
+}
+
+static uint8_t a_benchmark_angle_convert_to_fixed_array(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_angle_convert_to_fixed_array(&gs_handle, AS5600_FIXED_FORMAT_TURN_Q15, gs_reg, gs_fixed, BENCHMARK_ARRAY_LEN);
+}
+
+static uint8_t a_benchmark_angle_unwrap_array(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_angle_unwrap_array(&gs_handle, gs_reg, gs_position, BENCHMARK_ARRAY_LEN, &gs_last_raw, &gs_last_position);
+}
+
+static uint8_t a_benchmark_range_load(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_range_load(&gs_handle);
+}
+
+static uint8_t a_benchmark_range_convert_to_fixed(uint32_t i)
+{
+    int32_t angle;
+    uint8_t res;
+    
+    res = as5600_range_convert_to_fixed(&gs_handle, AS5600_FIXED_FORMAT_DEG_Q16, (uint16_t)(i & 0xFFF), &angle);
+    gs_sink = (uint32_t)angle;
+    
+    return res;
+}
+
+#if (AS5600_FLOAT_ENABLE == 1)
+static uint8_t a_benchmark_range_convert_to_data(uint32_t i)
+{
+    float deg;
+    uint8_t res;
+    
+    res = as5600_range_convert_to_data(&gs_handle, (uint16_t)(i & 0xFFF), &deg);
+    gs_sink = (uint32_t)deg;
+    
+    return res;
+}
+#endif
+
+static uint8_t a_benchmark_set_start_position(uint32_t i)
+{
+    return as5600_set_start_position(&gs_handle, (uint16_t)(i & 0xFFF));
+}
+
+static uint8_t a_benchmark_get_start_position(uint32_t i)
+{
+    uint16_t pos;
+    
+    (void)i;
+    
+    return as5600_get_start_position(&gs_handle, &pos);
+}
+
+static uint8_t a_benchmark_set_stop_position(uint32_t i)
+{
+    return as5600_set_stop_position(&gs_handle, (uint16_t)(i & 0xFFF));
+}
+
+static uint8_t a_benchmark_get_stop_position(uint32_t i)
+{
+    uint16_t pos;
+    
+    (void)i;
+    
+    return as5600_get_stop_position(&gs_handle, &pos);
+}
+
+static uint8_t a_benchmark_set_max_angle(uint32_t i)
+{
+    return as5600_set_max_angle(&gs_handle, (uint16_t)(i & 0xFFF));
+}
+
+static uint8_t a_benchmark_get_max_angle(uint32_t i)
+{
+    uint16_t ang;
+    
+    (void)i;
+    
+    return as5600_get_max_angle(&gs_handle, &ang);
+}
+
+static uint8_t a_benchmark_set_output_range(uint32_t i)
+{
+    return as5600_set_output_range(&gs_handle, (uint16_t)(i & 0x7FF), (uint16_t)((i & 0x7FF) + 2048), 0);
+}
+
+static uint8_t a_benchmark_set_watch_dog(uint32_t i)
+{
+    return as5600_set_watch_dog(&gs_handle, (as5600_bool_t)(i & 1));
+}
+
+static uint8_t a_benchmark_get_watch_dog(uint32_t i)
+{
+    as5600_bool_t enable;
+    
+    (void)i;
+    
+    return as5600_get_watch_dog(&gs_handle, &enable);
+}
+
+static uint8_t a_benchmark_set_fast_filter_threshold(uint32_t i)
+{
+    return as5600_set_fast_filter_threshold(&gs_handle, (as5600_fast_filter_threshold_t)(i & 7));
+}
+
+static uint8_t a_benchmark_get_fast_filter_threshold(uint32_t i)
+{
+    as5600_fast_filter_threshold_t threshold;
+    
+    (void)i;
+    
+    return as5600_get_fast_filter_threshold(&gs_handle, &threshold);
+}
+
+static uint8_t a_benchmark_set_slow_filter(uint32_t i)
+{
+    return as5600_set_slow_filter(&gs_handle, (as5600_slow_filter_t)(i & 3));
+}
+
+static uint8_t a_benchmark_get_slow_filter(uint32_t i)
+{
+    as5600_slow_filter_t filter;
+    
+    (void)i;
+    
+    return as5600_get_slow_filter(&gs_handle, &filter);
+}
+
+static uint8_t a_benchmark_set_pwm_frequency(uint32_t i)
+{
+    return as5600_set_pwm_frequency(&gs_handle, (as5600_pwm_frequency_t)(i & 3));
+}
+
+static uint8_t a_benchmark_get_pwm_frequency(uint32_t i)
+{
+    as5600_pwm_frequency_t freq;
+    
+    (void)i;
+    
+    return as5600_get_pwm_frequency(&gs_handle, &freq);
+}
+
+static uint8_t a_benchmark_set_output_stage(uint32_t i)
+{
+    return as5600_set_output_stage(&gs_handle, (as5600_output_stage_t)(i % 3));
+}
+
+static uint8_t a_benchmark_get_output_stage(uint32_t i)
+{
+    as5600_output_stage_t stage;
+    
+    (void)i;
+    
+    return as5600_get_output_stage(&gs_handle, &stage);
+}
+
+static uint8_t a_benchmark_set_hysteresis(uint32_t i)
+{
+    return as5600_set_hysteresis(&gs_handle, (as5600_hysteresis_t)(i & 3));
+}
+
+static uint8_t a_benchmark_get_hysteresis(uint32_t i)
+{
+    as5600_hysteresis_t hysteresis;
+    
+    (void)i;
+    
+    return as5600_get_hysteresis(&gs_handle, &hysteresis);
+}
+
+static uint8_t a_benchmark_set_power_mode(uint32_t i)
+{
+    return as5600_set_power_mode(&gs_handle, (as5600_power_mode_t)(i & 3));
+}
+
+static uint8_t a_benchmark_get_power_mode(uint32_t i)
+{
+    as5600_power_mode_t mode;
+    
+    (void)i;
+    
+    return as5600_get_power_mode(&gs_handle, &mode);
+}
+
+static uint8_t a_benchmark_get_raw_angle(uint32_t i)
+{
+    uint16_t ang;
+    
+    (void)i;
+    
+    return as5600_get_raw_angle(&gs_handle, &ang);
+}
+
+static uint8_t a_benchmark_get_angle(uint32_t i)
+{
+    uint16_t ang;
+    
+    (void)i;
+    
+    return as5600_get_angle(&gs_handle, &ang);
+}
+
+static uint8_t a_benchmark_get_status(uint32_t i)
+{
+    uint8_t status;
+    
+    (void)i;
+    
+    return as5600_get_status(&gs_handle, &status);
+}
+
+static uint8_t a_benchmark_get_agc(uint32_t i)
+{
+    uint8_t agc;
+    
+    (void)i;
+    
+    return as5600_get_agc(&gs_handle, &agc);
+}
+
+static uint8_t a_benchmark_get_magnitude(uint32_t i)
+{
+    uint16_t magnitude;
+    
+    (void)i;
+    
+    return as5600_get_magnitude(&gs_handle, &magnitude);
+}
+
+static uint8_t a_benchmark_read_snapshot(uint32_t i)
+{
+    as5600_snapshot_t snapshot;
+    
+    (void)i;
+    
+    return as5600_read_snapshot(&gs_handle, AS5600_BOOL_FALSE, &snapshot);
+}
+
+static uint8_t a_benchmark_read_snapshot_diagnostic(uint32_t i)
+{
+    as5600_snapshot_t snapshot;
+    
+    (void)i;
+    
+    return as5600_read_snapshot(&gs_handle, AS5600_BOOL_TRUE, &snapshot);
+}
+
+static uint8_t a_benchmark_start_stop_poll_read(uint32_t i)
+{
+    (void)i;
+    if (as5600_start_poll_read(&gs_handle, AS5600_POLL_REGISTER_ANGLE) != 0)
+    {
+        return 1;
+    }
+    
+    return as5600_stop_poll_read(&gs_handle);
+}
+
+static uint8_t a_benchmark_poll_read(uint32_t i)
+{
+    uint16_t data;
+    
+    (void)i;
+    
+    return as5600_poll_read(&gs_handle, &data);
+}
+
+static uint8_t a_benchmark_read_burst(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_read_burst(&gs_handle, gs_reg, 8);
+}
+
+static uint8_t a_benchmark_read_start_poll(uint32_t i)
+{
+    uint16_t raw;
+    
+    (void)i;
+    if (as5600_read_start(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    return as5600_read_poll(&gs_handle, &raw);
+}
+
+static uint8_t a_benchmark_set_shadow_cache(uint32_t i)
+{
+    return as5600_set_shadow_cache(&gs_handle, (as5600_bool_t)(i & 1));
+}
+
+static uint8_t a_benchmark_get_shadow_cache(uint32_t i)
+{
+    as5600_bool_t enable;
+    
+    (void)i;
+    
+    return as5600_get_shadow_cache(&gs_handle, &enable);
+}
+
+static uint8_t a_benchmark_shadow_cache_refresh(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_shadow_cache_refresh(&gs_handle);
+}
+
+static uint8_t a_benchmark_shadow_cache_invalidate(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_shadow_cache_invalidate(&gs_handle);
+}
+
+static uint8_t a_benchmark_apply_config(uint32_t i)
+{
+    as5600_config_t config;
+    
+    config.start_position = (uint16_t)(i & 0xFFF);
+    config.stop_position = (uint16_t)((i + 2048) & 0xFFF);
+    config.max_angle = 0;
+    config.watch_dog = (as5600_bool_t)(i & 1);
+    config.fast_filter_threshold = AS5600_FAST_FILTER_THRESHOLD_6LSB;
+    config.slow_filter = AS5600_SLOW_FILTER_4X;
+    config.pwm_frequency = AS5600_PWM_FREQUENCY_460HZ;
+    config.output_stage = AS5600_OUTPUT_STAGE_PWM;
+    config.hysteresis = AS5600_HYSTERESIS_1LSB;
+    config.power_mode = AS5600_POWER_MODE_NOM;
+    
+    return as5600_apply_config(&gs_handle, &config, AS5600_BOOL_FALSE);
+}
+
+static uint8_t a_benchmark_apply_config_diff(uint32_t i)
+{
+    as5600_config_t config;
+    
+    if (as5600_get_config(&gs_handle, &config) != 0)
+    {
+        return 1;
+    }
+    config.watch_dog = (as5600_bool_t)(i & 1);
+    
+    return as5600_apply_config(&gs_handle, &config, AS5600_BOOL_TRUE);
+}
+
+static uint8_t a_benchmark_get_config(uint32_t i)
+{
+    as5600_config_t config;
+    
+    (void)i;
+    
+    return as5600_get_config(&gs_handle, &config);
+}
+
+static uint8_t a_benchmark_field_set(uint32_t i)
+{
+    return as5600_field_set(&gs_handle, AS5600_FIELD_WATCH_DOG, (uint16_t)(i & 1));
+}
+
+static uint8_t a_benchmark_field_get(uint32_t i)
+{
+    uint16_t value;
+    
+    (void)i;
+    
+    return as5600_field_get(&gs_handle, AS5600_FIELD_WATCH_DOG, &value);
+}
+
+static uint8_t a_benchmark_field_set_multiple(uint32_t i)
+{
+    as5600_field_value_t list[3];
+    
+    list[0].field = AS5600_FIELD_START_POSITION;
+    list[0].value = (uint16_t)(i & 0xFFF);
+    list[1].field = AS5600_FIELD_STOP_POSITION;
+    list[1].value = (uint16_t)((i + 2048) & 0xFFF);
+    list[2].field = AS5600_FIELD_HYSTERESIS;
+    list[2].value = (uint16_t)(i & 3);
+    
+    return as5600_field_set_multiple(&gs_handle, list, 3);
+}
+
+static uint8_t a_benchmark_field_get_multiple(uint32_t i)
+{
+    as5600_field_value_t list[3];
+    
+    (void)i;
+    list[0].field = AS5600_FIELD_START_POSITION;
+    list[1].field = AS5600_FIELD_STOP_POSITION;
+    list[2].field = AS5600_FIELD_HYSTERESIS;
+    
+    return as5600_field_get_multiple(&gs_handle, list, 3);
+}
+
+static uint8_t a_benchmark_multi_turn_init(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_multi_turn_init(&gs_handle, 1024);
+}
+
+static uint8_t a_benchmark_multi_turn_update(uint32_t i)
+{
+    int64_t position;
+    as5600_bool_t alias;
+    uint8_t res;
+    
+    res = as5600_multi_turn_update(&gs_handle, (uint16_t)((i * 37) & 0xFFF), &position, &alias);
+    gs_sink = (uint32_t)position;
+    
+    return res;
+}
+
+static uint8_t a_benchmark_multi_turn_read(uint32_t i)
+{
+    int64_t position;
+    as5600_bool_t alias;
+    
+    (void)i;
+    
+    return as5600_multi_turn_read(&gs_handle, &position, &alias);
+}
+
+static uint8_t a_benchmark_multi_turn_get_alias_count(uint32_t i)
+{
+    uint32_t cnt;
+    
+    (void)i;
+    
+    return as5600_multi_turn_get_alias_count(&gs_handle, &cnt);
+}
+
+static uint8_t a_benchmark_get_sample_timestamp(uint32_t i)
+{
+    uint32_t timestamp;
+    
+    (void)i;
+    
+    return as5600_get_sample_timestamp(&gs_handle, &timestamp);
+}
+
+static uint8_t a_benchmark_set_zero_offset(uint32_t i)
+{
+    return as5600_set_zero_offset(&gs_handle, (uint16_t)(i & 0xFFF));
+}
+
+static uint8_t a_benchmark_get_zero_offset(uint32_t i)
+{
+    uint16_t offset;
+    
+    (void)i;
+    
+    return as5600_get_zero_offset(&gs_handle, &offset);
+}
+
+static uint8_t a_benchmark_set_direction_invert(uint32_t i)
+{
+    return as5600_set_direction_invert(&gs_handle, (as5600_bool_t)(i & 1));
+}
+
+static uint8_t a_benchmark_get_direction_invert(uint32_t i)
+{
+    as5600_bool_t enable;
+    
+    (void)i;
+    
+    return as5600_get_direction_invert(&gs_handle, &enable);
+}
+
+static uint8_t a_benchmark_capture_zero(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_capture_zero(&gs_handle);
+}
+
+static uint8_t a_benchmark_set_verify(uint32_t i)
+{
+    return as5600_set_verify(&gs_handle, (as5600_bool_t)(i & 1));
+}
+
+static uint8_t a_benchmark_get_verify(uint32_t i)
+{
+    as5600_bool_t enable;
+    
+    (void)i;
+    
+    return as5600_get_verify(&gs_handle, &enable);
+}
+
+static uint8_t a_benchmark_set_verify_max_step(uint32_t i)
+{
+    return as5600_set_verify_max_step(&gs_handle, (uint16_t)((i % 2047) + 1));
+}
+
+static uint8_t a_benchmark_get_verify_max_step(uint32_t i)
+{
+    uint16_t step;
+    
+    (void)i;
+    
+    return as5600_get_verify_max_step(&gs_handle, &step);
+}
+
+static uint8_t a_benchmark_get_verify_count(uint32_t i)
+{
+    uint32_t reserved;
+    uint32_t jump;
+    
+    (void)i;
+    
+    return as5600_get_verify_count(&gs_handle, &reserved, &jump);
+}
+
+static uint8_t a_benchmark_ring_init(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_ring_init(&gs_ring, gs_ring_buf, 8);
+}
+
+static uint8_t a_benchmark_ring_sample_pop(uint32_t i)
+{
+    as5600_sample_t sample;
+    
+    (void)i;
+    if (as5600_ring_sample(&gs_handle, &gs_ring) != 0)
+    {
+        return 1;
+    }
+    
+    return as5600_ring_pop(&gs_ring, &sample);
+}
+
+static uint8_t a_benchmark_ring_get_count(uint32_t i)
+{
+    uint32_t count;
+    uint32_t dropped;
+    
+    (void)i;
+    
+    return as5600_ring_get_count(&gs_ring, &count, &dropped);
+}
+
+static uint8_t a_benchmark_stream_encode(uint32_t i)
+{
+    as5600_sample_t sample;
+    
+    sample.timestamp_us = i;
+    sample.raw_angle = (uint16_t)(i & 0xFFF);
+    sample.status = AS5600_STATUS_MD;
+    sample.sequence = (uint16_t)i;
+    
+    return as5600_stream_encode(&sample, sample.sequence, gs_frame);
+}
+
+static uint8_t a_benchmark_stream_decode(uint32_t i)
+{
+    as5600_sample_t sample;
+    uint16_t sequence;
+    
+    (void)i;
+    
+    return as5600_stream_decode(gs_frame, &sequence, &sample);
+}
+
+#if (AS5600_STATS_ENABLE == 1)
+static uint8_t a_benchmark_get_stats(uint32_t i)
+{
+    as5600_stats_t stats;
+    
+    (void)i;
+    
+    return as5600_get_stats(&gs_handle, &stats);
+}
+
+static uint8_t a_benchmark_clear_stats(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_clear_stats(&gs_handle);
+}
+#endif
+
+static uint8_t a_benchmark_set_burn(uint32_t i)
+{
+    (void)i;
+    
+    return as5600_set_burn(&gs_handle, AS5600_BURN_CMD1);
+}
+
+static uint8_t a_benchmark_set_reg(uint32_t i)
+{
+    uint8_t buf[2];
+    
+    buf[0] = (uint8_t)((i >> 8) & 0x0F);
+    buf[1] = (uint8_t)(i & 0xFF);
+    
+    return as5600_set_reg(&gs_handle, 0x01, buf, 2);
+}
+
+static uint8_t a_benchmark_get_reg(uint32_t i)
+{
+    uint8_t buf[2];
+    
+    (void)i;
+    
+    return as5600_get_reg(&gs_handle, 0x0C, buf, 2);
+}
+
+/**
+ * @brief benchmark case table
+ */
+static const benchmark_case_t gs_case[] =
+{
+    {"as5600_info", NULL, a_benchmark_info, NULL},
+    {"as5600_init+as5600_deinit", NULL, a_benchmark_init_deinit, a_benchmark_reinit},
+#if (AS5600_FLOAT_ENABLE == 1)
+    {"as5600_read", NULL, a_benchmark_read, NULL},
+    {"as5600_angle_convert_to_register", NULL, a_benchmark_angle_convert_to_register, NULL},
+    {"as5600_angle_convert_to_data", NULL, a_benchmark_angle_convert_to_data, NULL},
+    {"as5600_angle_convert_to_data_array[64]", NULL, a_benchmark_angle_convert_to_data_array, NULL},
+    {"as5600_angle_convert_to_rad_array[64]", NULL, a_benchmark_angle_convert_to_rad_array, NULL},
+#endif
+    {"as5600_read_fixed", NULL, a_benchmark_read_fixed, NULL},
+    {"as5600_angle_convert_from_fixed", NULL, a_benchmark_angle_convert_from_fixed, NULL},
+    {"as5600_angle_convert_to_fixed", NULL, a_benchmark_angle_convert_to_fixed, NULL},
+    {"as5600_angle_convert_to_fixed_array[64]", NULL, a_benchmark_angle_convert_to_fixed_array, NULL},
+    {"as5600_angle_unwrap_array[64]", NULL, a_benchmark_angle_unwrap_array, NULL},
+    {"as5600_range_load", NULL, a_benchmark_range_load, NULL},
+    {"as5600_range_convert_to_fixed", a_benchmark_range_on, a_benchmark_range_convert_to_fixed, NULL},
+#if (AS5600_FLOAT_ENABLE == 1)
+    {"as5600_range_convert_to_data", a_benchmark_range_on, a_benchmark_range_convert_to_data, NULL},
+#endif
+    {"as5600_set_start_position", NULL, a_benchmark_set_start_position, NULL},
+    {"as5600_get_start_position", NULL, a_benchmark_get_start_position, NULL},
+    {"as5600_set_stop_position", NULL, a_benchmark_set_stop_position, NULL},
+    {"as5600_get_stop_position", NULL, a_benchmark_get_stop_position, NULL},
+    {"as5600_set_max_angle", NULL, a_benchmark_set_max_angle, NULL},
+    {"as5600_get_max_angle", NULL, a_benchmark_get_max_angle, NULL},
+    {"as5600_set_output_range", NULL, a_benchmark_set_output_range, NULL},
+    {"as5600_set_watch_dog", NULL, a_benchmark_set_watch_dog, NULL},
+    {"as5600_get_watch_dog", NULL, a_benchmark_get_watch_dog, NULL},
+    {"as5600_set_fast_filter_threshold", NULL, a_benchmark_set_fast_filter_threshold, NULL},
+    {"as5600_get_fast_filter_threshold", NULL, a_benchmark_get_fast_filter_threshold, NULL},
+    {"as5600_set_slow_filter", NULL, a_benchmark_set_slow_filter, NULL},
+    {"as5600_get_slow_filter", NULL, a_benchmark_get_slow_filter, NULL},
+    {"as5600_set_pwm_frequency", NULL, a_benchmark_set_pwm_frequency, NULL},
+    {"as5600_get_pwm_frequency", NULL, a_benchmark_get_pwm_frequency, NULL},
+    {"as5600_set_output_stage", NULL, a_benchmark_set_output_stage, NULL},
+    {"as5600_get_output_stage", NULL, a_benchmark_get_output_stage, NULL},
+    {"as5600_set_hysteresis", NULL, a_benchmark_set_hysteresis, NULL},
+    {"as5600_get_hysteresis", NULL, a_benchmark_get_hysteresis, NULL},
+    {"as5600_set_power_mode", NULL, a_benchmark_set_power_mode, NULL},
+    {"as5600_get_power_mode", NULL, a_benchmark_get_power_mode, NULL},
+    {"as5600_set_watch_dog(shadow)", a_benchmark_shadow_on, a_benchmark_set_watch_dog, a_benchmark_shadow_off},
+    {"as5600_get_watch_dog(shadow)", a_benchmark_shadow_on, a_benchmark_get_watch_dog, a_benchmark_shadow_off},
+    {"as5600_get_raw_angle", NULL, a_benchmark_get_raw_angle, NULL},
+    {"as5600_get_angle", NULL, a_benchmark_get_angle, NULL},
+    {"as5600_get_status", NULL, a_benchmark_get_status, NULL},
+    {"as5600_get_agc", NULL, a_benchmark_get_agc, NULL},
+    {"as5600_get_magnitude", NULL, a_benchmark_get_magnitude, NULL},
+    {"as5600_read_snapshot", NULL, a_benchmark_read_snapshot, NULL},
+    {"as5600_read_snapshot(diagnostic)", NULL, a_benchmark_read_snapshot_diagnostic, NULL},
+    {"as5600_start_poll_read+as5600_stop_poll_read", NULL, a_benchmark_start_stop_poll_read, NULL},
+    {"as5600_poll_read", a_benchmark_poll_on, a_benchmark_poll_read, a_benchmark_poll_off},
+    {"as5600_read_burst[8]", NULL, a_benchmark_read_burst, NULL},
+    {"as5600_read_start+as5600_read_poll", NULL, a_benchmark_read_start_poll, NULL},
+    {"as5600_set_shadow_cache", NULL, a_benchmark_set_shadow_cache, a_benchmark_shadow_off},
+    {"as5600_get_shadow_cache", NULL, a_benchmark_get_shadow_cache, NULL},
+    {"as5600_shadow_cache_refresh", a_benchmark_shadow_on, a_benchmark_shadow_cache_refresh, a_benchmark_shadow_off},
+    {"as5600_shadow_cache_invalidate", a_benchmark_shadow_on, a_benchmark_shadow_cache_invalidate, a_benchmark_shadow_off},
+    {"as5600_apply_config", NULL, a_benchmark_apply_config, NULL},
+    {"as5600_get_config+as5600_apply_config(diff)", NULL, a_benchmark_apply_config_diff, NULL},
+    {"as5600_get_config+as5600_apply_config(diff,shadow)", a_benchmark_shadow_on, a_benchmark_apply_config_diff, a_benchmark_shadow_off},
+    {"as5600_get_config", NULL, a_benchmark_get_config, NULL},
+    {"as5600_field_set", NULL, a_benchmark_field_set, NULL},
+    {"as5600_field_get", NULL, a_benchmark_field_get, NULL},
+    {"as5600_field_set_multiple[3]", NULL, a_benchmark_field_set_multiple, NULL},
+    {"as5600_field_get_multiple[3]", NULL, a_benchmark_field_get_multiple, NULL},
+    {"as5600_field_set_multiple[3](shadow)", a_benchmark_shadow_on, a_benchmark_field_set_multiple, a_benchmark_shadow_off},
+    {"as5600_multi_turn_init", NULL, a_benchmark_multi_turn_init, NULL},
+    {"as5600_multi_turn_update", a_benchmark_multi_turn_on, a_benchmark_multi_turn_update, NULL},
+    {"as5600_multi_turn_read", a_benchmark_multi_turn_on, a_benchmark_multi_turn_read, NULL},
+    {"as5600_multi_turn_get_alias_count", a_benchmark_multi_turn_on, a_benchmark_multi_turn_get_alias_count, NULL},
+    {"as5600_get_sample_timestamp", NULL, a_benchmark_get_sample_timestamp, NULL},
+    {"as5600_set_zero_offset", NULL, a_benchmark_set_zero_offset, a_benchmark_reinit},
+    {"as5600_get_zero_offset", NULL, a_benchmark_get_zero_offset, NULL},
+    {"as5600_set_direction_invert", NULL, a_benchmark_set_direction_invert, a_benchmark_reinit},
+    {"as5600_get_direction_invert", NULL, a_benchmark_get_direction_invert, NULL},
+    {"as5600_capture_zero", NULL, a_benchmark_capture_zero, a_benchmark_reinit},
+    {"as5600_set_verify", NULL, a_benchmark_set_verify, a_benchmark_reinit},
+    {"as5600_get_verify", NULL, a_benchmark_get_verify, NULL},
+    {"as5600_set_verify_max_step", NULL, a_benchmark_set_verify_max_step, a_benchmark_reinit},
+    {"as5600_get_verify_max_step", NULL, a_benchmark_get_verify_max_step, NULL},
+    {"as5600_get_verify_count", NULL, a_benchmark_get_verify_count, NULL},
+    {"as5600_get_raw_angle(verify)", a_benchmark_verify_on, a_benchmark_get_raw_angle, a_benchmark_reinit},
+    {"as5600_ring_init", NULL, a_benchmark_ring_init, NULL},
+    {"as5600_ring_sample+as5600_ring_pop", a_benchmark_ring_on, a_benchmark_ring_sample_pop, NULL},
+    {"as5600_ring_get_count", a_benchmark_ring_on, a_benchmark_ring_get_count, NULL},
+    {"as5600_stream_encode", NULL, a_benchmark_stream_encode, NULL},
+    {"as5600_stream_decode", a_benchmark_frame_on, a_benchmark_stream_decode, NULL},
+#if (AS5600_STATS_ENABLE == 1)
+    {"as5600_get_stats", NULL, a_benchmark_get_stats, NULL},
+    {"as5600_clear_stats", NULL, a_benchmark_clear_stats, NULL},
+#endif
+    {"as5600_set_burn", NULL, a_benchmark_set_burn, NULL},
+    {"as5600_set_reg", NULL, a_benchmark_set_reg, NULL},
+    {"as5600_get_reg", NULL, a_benchmark_get_reg, NULL},
+};
+
+/**
+ * @brief     benchmark main
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: driver_as5600_api_benchmark [iterations] [json file] [stretch ns per byte]
+ */
+int main(int argc, char **argv)
+{
+    uint32_t i;
+    uint32_t c;
+    uint32_t iterations;
+    uint64_t t;
+    double ns;
+    double wire[3];
+    FILE *fp;
+    
+    iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 100000;
+    if (iterations == 0)
+    {
+        (void)printf("as5600: iterations must be > 0.\n");
+        
+        return 1;
+    }
+    as5600_sim_timing_init(&gs_timing[0], 100000);
+    as5600_sim_timing_init(&gs_timing[1], 400000);
+    as5600_sim_timing_init(&gs_timing[2], 1000000);
+    for (i = 0; i < 3; i++)
+    {
+        gs_timing[i].t_stretch_ns = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 0) : 0;
+    }
+    fp = NULL;
+    if (argc > 2)
+    {
+        fp = fopen(argv[2], "w");
+        if (fp == NULL)
+        {
+            (void)printf("as5600: open %s failed.\n", argv[2]);
+            
+            return 1;
+        }
+    }
+    
+    /* link the simulated device */
+    as5600_sim_reset(&gs_sim);
+    DRIVER_AS5600_LINK_INIT(&gs_handle, as5600_handle_t);
+    as5600_sim_link(&gs_handle, &gs_sim);
+    DRIVER_AS5600_LINK_DELAY_MS(&gs_handle, a_benchmark_delay_ms);
+    DRIVER_AS5600_LINK_TIMESTAMP_US(&gs_handle, a_benchmark_timestamp_us);
+    DRIVER_AS5600_LINK_DEBUG_PRINT(&gs_handle, a_benchmark_debug_print);
+    DRIVER_AS5600_LINK_IIC_READ_ASYNC(&gs_handle, a_benchmark_iic_read_async);
+    if (as5600_init(&gs_handle) != 0)
+    {
+        if (fp != NULL)
+        {
+            (void)fclose(fp);
+        }
+        
+        return 1;
+    }
+    for (i = 0; i < BENCHMARK_ARRAY_LEN; i++)
+    {
+        gs_reg[i] = (uint16_t)((i * 37U) & 0xFFF);
+    }
+    
+    /* run all cases */
+    (void)printf("as5600: %u iterations per case.\n", (unsigned)iterations);
+    (void)printf("%-48s %10s %10s %10s %10s %10s %10s %10s\n", "function", "ns/call", "xfers/call", "msgs/call",
+                 "bytes/call", "us@100k", "us@400k", "us@1M");
+    if (fp != NULL)
+    {
+        (void)fprintf(fp, "{\n  \"benchmark\": \"as5600_api\",\n  \"iterations\": %u,\n  \"float\": %d,\n"
+                      "  \"stretch_ns\": %u,\n  \"results\": [\n",
+                      (unsigned)iterations, AS5600_FLOAT_ENABLE, (unsigned)gs_timing[0].t_stretch_ns);
+    }
+    for (c = 0; c < sizeof(gs_case) / sizeof(gs_case[0]); c++)
+    {
+        if (gs_case[c].setup != NULL)
+        {
+            gs_case[c].setup();
+        }
+        as5600_sim_clear_counter(&gs_sim);
+        t = a_benchmark_now_ns();
+        for (i = 0; i < iterations; i++)
+        {
+            if (gs_case[c].run(i) != 0)
+            {
+                (void)printf("as5600: %s failed.\n", gs_case[c].name);
+                (void)as5600_deinit(&gs_handle);
+                if (fp != NULL)
+                {
+                    (void)fclose(fp);
+                }
+                
+                return 1;
+            }
+        }
+        ns = (double)(a_benchmark_now_ns() - t) / (double)iterations;
+        if (gs_case[c].teardown != NULL)
+        {
+            gs_case[c].teardown();
+        }
+        
+        /* report */
+        for (i = 0; i < 3; i++)
+        {
+            wire[i] = (double)as5600_sim_get_wire_time(&gs_sim, &gs_timing[i]) / 1000.0 / iterations;
+        }
+        (void)printf("%-48s %10.1f %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n", gs_case[c].name, ns,
+                     (double)gs_sim.transfers / iterations, (double)gs_sim.msgs / iterations,
+                     (double)gs_sim.bytes / iterations, wire[0], wire[1], wire[2]);
+        if (fp != NULL)
+        {
+            (void)fprintf(fp, "    {\"name\": \"%s\", \"ns_per_call\": %.1f, \"transfers_per_call\": %.2f, "
+                          "\"msgs_per_call\": %.2f, \"bytes_per_call\": %.2f, "
+                          "\"wire_us_100k\": %.2f, \"wire_us_400k\": %.2f, \"wire_us_1m\": %.2f}%s\n",
+                          gs_case[c].name, ns, (double)gs_sim.transfers / iterations,
+                          (double)gs_sim.msgs / iterations, (double)gs_sim.bytes / iterations,
+                          wire[0], wire[1], wire[2],
+                          (c + 1 < sizeof(gs_case) / sizeof(gs_case[0])) ? "," : "");
+        }
+    }
+    if (fp != NULL)
+    {
+        (void)fprintf(fp, "  ]\n}\n");
+        (void)fclose(fp);
+    }
+    (void)as5600_deinit(&gs_handle);
+    
+    return 0;
+}
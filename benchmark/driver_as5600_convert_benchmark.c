@@ -0,0 +1,305 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_as5600_convert_benchmark.c
+ * @brief     driver as5600 convert benchmark source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-09-30
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/09/30  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "driver_as5600.h"
+#include <stdarg.h>
+#include <stdlib.h>
+#include <time.h>
+
+static as5600_handle_t gs_handle;        /**< as5600 handle */
+static volatile float gs_sink_f;         /**< float result sink */
+static volatile int32_t gs_sink_i;       /**< integer result sink */
+
+/**
+ * @brief  benchmark iic init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_benchmark_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  benchmark iic deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_benchmark_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     benchmark iic bus read and write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      the benchmark never touches the bus
+ */
+static uint8_t a_benchmark_iic_rw(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)reg;
+    memset(buf, 0, len);
+    
+    return 0;
+}
+
+/**
+ * @brief     benchmark delay
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_benchmark_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     benchmark print
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_benchmark_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vprintf(fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_benchmark_now_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     print one benchmark result
+ * @param[in] *name pointer to a name buffer
+ * @param[in] len samples per round
+ * @param[in] rounds rounds
+ * @param[in] ns total time in ns
+ * @note      none
+ */
+static void a_benchmark_report(const char *name, uint32_t len, uint32_t rounds, uint64_t ns)
+{
+    double msps;
+    
+    msps = ((double)len * (double)rounds) / ((double)ns / 1000.0);
+    (void)printf("%-28s %10.2f Msample/s %8.3f ns/sample\n", name, msps, 1000.0 / msps);
+}
+
+/**
+ * @brief     benchmark main
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      usage: driver_as5600_convert_benchmark [samples] [rounds]
+ */
+int main(int argc, char **argv)
+{
+    uint32_t i;
+    uint32_t r;
+    uint32_t len;
+    uint32_t rounds;
+    uint64_t t;
+    uint16_t *reg;
+    int32_t *fixed;
+    int64_t *positions;
+    int64_t position;
+    uint16_t last_raw;
+    as5600_bool_t alias;
+#if (AS5600_FLOAT_ENABLE == 1)
+    float *deg;
+#endif
+    
+    len = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : (1U << 20);
+    rounds = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 20;
+    if ((len == 0) || (rounds == 0))
+    {
+        (void)printf("as5600: samples and rounds must be > 0.\n");
+        
+        return 1;
+    }
+    
+    /* link interface function */
+    DRIVER_AS5600_LINK_INIT(&gs_handle, as5600_handle_t);
+    DRIVER_AS5600_LINK_IIC_INIT(&gs_handle, a_benchmark_iic_init);
+    DRIVER_AS5600_LINK_IIC_DEINIT(&gs_handle, a_benchmark_iic_deinit);
+    DRIVER_AS5600_LINK_IIC_READ(&gs_handle, a_benchmark_iic_rw);
+    DRIVER_AS5600_LINK_IIC_WRITE(&gs_handle, a_benchmark_iic_rw);
+    DRIVER_AS5600_LINK_DELAY_MS(&gs_handle, a_benchmark_delay_ms);
+    DRIVER_AS5600_LINK_DEBUG_PRINT(&gs_handle, a_benchmark_debug_print);
+    if (as5600_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    /* make a slowly rotating input */
+    reg = (uint16_t *)malloc(sizeof(uint16_t) * len);
+    fixed = (int32_t *)malloc(sizeof(int32_t) * len);
+    positions = (int64_t *)malloc(sizeof(int64_t) * len);
+#if (AS5600_FLOAT_ENABLE == 1)
+    deg = (float *)malloc(sizeof(float) * len);
+    if (deg == NULL)
+    {
+        free(reg);
+        free(fixed);
+        free(positions);
+        
+        return 1;
+    }
+#endif
+    if ((reg == NULL) || (fixed == NULL) || (positions == NULL))
+    {
+#if (AS5600_FLOAT_ENABLE == 1)
+        free(deg);
+#endif
+        free(reg);
+        free(fixed);
+        free(positions);
+        
+        return 1;
+    }
+    for (i = 0; i < len; i++)
+    {
+        reg[i] = (uint16_t)((i * 37U) & 0xFFF);
+    }
+    (void)printf("as5600: %u samples x %u rounds.\n", (unsigned)len, (unsigned)rounds);
+    
+#if (AS5600_FLOAT_ENABLE == 1)
+    /* degrees */
+    t = a_benchmark_now_ns();
+    for (r = 0; r < rounds; r++)
+    {
+        for (i = 0; i < len; i++)
+        {
+            (void)as5600_angle_convert_to_data(&gs_handle, reg[i], &deg[i]);
+        }
+        gs_sink_f = deg[r % len];
+    }
+    a_benchmark_report("deg scalar", len, rounds, a_benchmark_now_ns() - t);
+    t = a_benchmark_now_ns();
+    for (r = 0; r < rounds; r++)
+    {
+        (void)as5600_angle_convert_to_data_array(&gs_handle, reg, deg, len);
+        gs_sink_f = deg[r % len];
+    }
+    a_benchmark_report("deg array", len, rounds, a_benchmark_now_ns() - t);
+    
+    /* radians */
+    t = a_benchmark_now_ns();
+    for (r = 0; r < rounds; r++)
+    {
+        (void)as5600_angle_convert_to_rad_array(&gs_handle, reg, deg, len);
+        gs_sink_f = deg[r % len];
+    }
+    a_benchmark_report("rad array", len, rounds, a_benchmark_now_ns() - t);
+#endif
+    
+    /* q1.15 turns */
+    t = a_benchmark_now_ns();
+    for (r = 0; r < rounds; r++)
+    {
+        for (i = 0; i < len; i++)
+        {
+            (void)as5600_angle_convert_to_fixed(&gs_handle, AS5600_FIXED_FORMAT_TURN_Q15, reg[i], &fixed[i]);
+        }
+        gs_sink_i = fixed[r % len];
+    }
+    a_benchmark_report("q15 scalar", len, rounds, a_benchmark_now_ns() - t);
+    t = a_benchmark_now_ns();
+    for (r = 0; r < rounds; r++)
+    {
+        (void)as5600_angle_convert_to_fixed_array(&gs_handle, AS5600_FIXED_FORMAT_TURN_Q15, reg, fixed, len);
+        gs_sink_i = fixed[r % len];
+    }
+    a_benchmark_report("q15 array", len, rounds, a_benchmark_now_ns() - t);
+    
+    /* unwrapped turns */
+    t = a_benchmark_now_ns();
+    for (r = 0; r < rounds; r++)
+    {
+        (void)as5600_multi_turn_init(&gs_handle, 2047);
+        for (i = 0; i < len; i++)
+        {
+            (void)as5600_multi_turn_update(&gs_handle, reg[i], &position, &alias);
+            fixed[i] = (int32_t)position;
+        }
+        gs_sink_i = fixed[r % len];
+    }
+    a_benchmark_report("unwrap scalar", len, rounds, a_benchmark_now_ns() - t);
+    t = a_benchmark_now_ns();
+    for (r = 0; r < rounds; r++)
+    {
+        last_raw = reg[0];
+        position = reg[0] & 0xFFF;
+        (void)as5600_angle_unwrap_array(&gs_handle, reg, positions, len, &last_raw, &position);
+        gs_sink_i = (int32_t)positions[r % len];
+    }
+    a_benchmark_report("unwrap array", len, rounds, a_benchmark_now_ns() - t);
+    
+    /* free */
+#if (AS5600_FLOAT_ENABLE == 1)
+    free(deg);
+#endif
+    free(reg);
+    free(fixed);
+    free(positions);
+    (void)as5600_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -55,7 +55,11 @@ uint8_t as5600_basic_init(void)
     DRIVER_AS5600_LINK_IIC_DEINIT(&gs_handle, as5600_interface_iic_deinit);
     DRIVER_AS5600_LINK_IIC_READ(&gs_handle, as5600_interface_iic_read);
     DRIVER_AS5600_LINK_IIC_WRITE(&gs_handle, as5600_interface_iic_write);
+    DRIVER_AS5600_LINK_IIC_READ_CMD(&gs_handle, as5600_interface_iic_read_cmd);
+    DRIVER_AS5600_LINK_IIC_READ_REPEAT(&gs_handle, as5600_interface_iic_read_repeat);
     DRIVER_AS5600_LINK_DELAY_MS(&gs_handle, as5600_interface_delay_ms);
+    DRIVER_AS5600_LINK_TIMESTAMP_US(&gs_handle, as5600_interface_timestamp_us);
+    DRIVER_AS5600_LINK_DELAY_US(&gs_handle, as5600_interface_delay_us);
     DRIVER_AS5600_LINK_DEBUG_PRINT(&gs_handle, as5600_interface_debug_print);
     
     /* as5600 init */
@@ -70,6 +74,8 @@ uint8_t as5600_basic_init(void)
     return 0;
 }
 
+#if (AS5600_FLOAT_ENABLE == 1)
+
 /**
  * @brief      basic example read
  * @param[out] *angle pointer to an angle buffer
@@ -95,6 +101,58 @@ uint8_t as5600_basic_read(float *angle)
     return 0;
 }
 
+#endif
+
+/**
+ * @brief      basic example read in a fixed point format
+ * @param[in]  format fixed point format
+ * @param[out] *angle pointer to a fixed point angle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_basic_read_fixed(as5600_fixed_format_t format, int32_t *angle)
+{
+    uint8_t res;
+    uint16_t angle_raw;
+    
+    /* read data */
+    res = as5600_read_fixed(&gs_handle, format, &angle_raw, angle);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: read failed.\n");
+       
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     basic example read one timestamped sample into a ring
+ * @param[in] *ring pointer to an as5600 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      a sample that finds the ring full is counted by the ring as dropped
+ */
+uint8_t as5600_basic_sample(as5600_ring_t *ring)
+{
+    uint8_t res;
+    
+    /* read into the ring */
+    res = as5600_ring_sample(&gs_handle, ring);
+    if ((res != 0) && (res != 4))
+    {
+        as5600_interface_debug_print("as5600: sample failed.\n");
+       
+        return 1;
+    }
+    
+    return 0;
+}
+
 /**
  * @brief  basic example deinit
  * @return status code
@@ -59,6 +59,8 @@ extern "C"{
  */
 uint8_t as5600_basic_init(void);
 
+#if (AS5600_FLOAT_ENABLE == 1)
+
 /**
  * @brief      basic example read
  * @param[out] *angle pointer to an angle buffer
@@ -69,6 +71,29 @@ uint8_t as5600_basic_init(void);
  */
 uint8_t as5600_basic_read(float *angle);
 
+#endif
+
+/**
+ * @brief      basic example read in a fixed point format
+ * @param[in]  format fixed point format
+ * @param[out] *angle pointer to a fixed point angle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_basic_read_fixed(as5600_fixed_format_t format, int32_t *angle);
+
+/**
+ * @brief     basic example read one timestamped sample into a ring
+ * @param[in] *ring pointer to an as5600 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      a sample that finds the ring full is counted by the ring as dropped
+ */
+uint8_t as5600_basic_sample(as5600_ring_t *ring);
+
 /**
  * @brief  basic example deinit
  * @return status code
@@ -92,6 +92,157 @@ uint8_t as5600_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint
     return 0;
 }
 
+/**
+ * @brief      interface iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus init with the user data
+ * @param[in] *user_data pointer to the bus structure of the port
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
+ */
+uint8_t as5600_interface_iic_init_ex(void *user_data)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus deinit with the user data
+ * @param[in] *user_data pointer to the bus structure of the port
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t as5600_interface_iic_deinit_ex(void *user_data)
+{
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus read with the user data
+ * @param[in]  *user_data pointer to the bus structure of the port
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read_ex(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write with the user data
+ * @param[in] *user_data pointer to the bus structure of the port
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t as5600_interface_iic_write_ex(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus read command with the user data
+ * @param[in]  *user_data pointer to the bus structure of the port
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read_cmd_ex(void *user_data, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus repeated read
+ * @param[in]  *user_data pointer to the bus structure of the port or NULL
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of one read
+ * @param[in]  num read times
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the register address is written once and then num reads of len bytes follow,
+ *             the buffer size must be len * num
+ */
+uint8_t as5600_interface_iic_read_repeat(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus async read
+ * @param[in]  *user_data pointer to the bus structure of the port or NULL
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *done pointer to a completion function
+ * @param[in]  *ctx pointer to the completion context
+ * @return     status code
+ *             - 0 success
+ *             - 1 read start failed
+ * @note       returns once the read is queued and calls done(ctx, res) when the transfer ends,
+ *             done may run in an interrupt or another thread, it is not called when the start fails
+ */
+uint8_t as5600_interface_iic_read_async(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                        void (*done)(void *ctx, uint8_t res), void *ctx)
+{
+    return 0;
+}
+
+/**
+ * @brief  interface timestamp us
+ * @return free running time in us
+ * @note   the value may wrap, the driver only uses the differences
+ */
+uint32_t as5600_interface_timestamp_us(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void as5600_interface_delay_us(uint32_t us)
+{
+
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -0,0 +1,453 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * SOFTWARE. 
+ *
+ * @file      host_driver_as5600_interface.c
+ * @brief     host driver as5600 interface source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-09-30
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/09/30  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "host_driver_as5600_interface.h"
+#include "driver_as5600_sim.h"
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief host bus definition
+ */
+#define HOST_BUS_NUM          4         /**< number of simulated buses */
+#define HOST_ANGLE_STEP       7         /**< raw angle step per delay ms */
+#define HOST_ASYNC_SCL_HZ     400000    /**< modeled scl clock of the async bus */
+
+/**
+ * @brief host async request structure definition
+ */
+typedef struct host_async_s
+{
+    as5600_sim_t *sim;                         /**< simulated device */
+    uint8_t addr;                              /**< iic device write address */
+    uint8_t reg;                               /**< iic register address */
+    uint8_t *buf;                              /**< data buffer */
+    uint16_t len;                              /**< data length */
+    void (*done)(void *ctx, uint8_t res);      /**< completion function */
+    void *ctx;                                 /**< completion context */
+    uint8_t pending;                           /**< request pending flag */
+} host_async_t;
+
+/**
+ * @brief host bus variable definition
+ */
+static as5600_sim_t gs_sim[HOST_BUS_NUM];        /**< simulated devices */
+static uint8_t gs_sim_inited[HOST_BUS_NUM];      /**< simulated device inited flags */
+static uint32_t gs_delay_us;                     /**< delayed us not yet turned into a magnet step */
+static pthread_mutex_t gs_mutex = PTHREAD_MUTEX_INITIALIZER;        /**< async request and magnet lock */
+static pthread_cond_t gs_cond = PTHREAD_COND_INITIALIZER;           /**< async request condition */
+static pthread_t gs_thread;                                         /**< async bus thread */
+static uint8_t gs_thread_started;                                   /**< async bus thread started flag */
+static host_async_t gs_async;                                       /**< async request */
+
+/**
+ * @brief     get the simulated device of a bus
+ * @param[in] *user_data pointer to an as5600_interface_bus_t structure or NULL
+ * @return    pointer to an as5600 sim structure
+ * @note      NULL selects bus 0
+ */
+static as5600_sim_t *a_host_get_sim(void *user_data)
+{
+    as5600_interface_bus_t *bus = (as5600_interface_bus_t *)user_data;
+    
+    if (bus == NULL)
+    {
+        return &gs_sim[0];
+    }
+    
+    return &gs_sim[bus->index];
+}
+
+/**
+ * @brief     async bus thread
+ * @param[in] *arg unused
+ * @return    never returns
+ * @note      every request is read from the simulated device and completed after its modeled wire time
+ */
+static void *a_host_async_thread(void *arg)
+{
+    host_async_t req;
+    as5600_sim_timing_t timing;
+    struct timespec ts;
+    uint64_t ns;
+    uint8_t res;
+    
+    (void)arg;
+    as5600_sim_timing_init(&timing, HOST_ASYNC_SCL_HZ);
+    while (1)
+    {
+        (void)pthread_mutex_lock(&gs_mutex);
+        while (gs_async.pending == 0)
+        {
+            (void)pthread_cond_wait(&gs_cond, &gs_mutex);
+        }
+        req = gs_async;
+        ns = as5600_sim_get_wire_time(req.sim, &timing);
+        res = as5600_sim_iic_read(req.sim, req.addr, req.reg, req.buf, req.len);
+        ns = as5600_sim_get_wire_time(req.sim, &timing) - ns;
+        gs_async.pending = 0;
+        (void)pthread_mutex_unlock(&gs_mutex);
+        
+        /* the transfer is on the wire */
+        ts.tv_sec = (time_t)(ns / 1000000000ULL);
+        ts.tv_nsec = (long)(ns % 1000000000ULL);
+        (void)nanosleep(&ts, NULL);
+        
+        req.done(req.ctx, res);
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     open a simulated bus
+ * @param[in] index bus index
+ * @return    status code
+ *            - 0 success
+ * @note      the device keeps its state until the process exits like a powered sensor
+ */
+static uint8_t a_host_open(int index)
+{
+    if (gs_sim_inited[index] == 0)
+    {
+        as5600_sim_reset(&gs_sim[index]);
+        gs_sim_inited[index] = 1;
+    }
+    
+    return as5600_sim_iic_init(&gs_sim[index]);
+}
+
+/**
+ * @brief  interface iic bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 iic init failed
+ * @note   none
+ */
+uint8_t as5600_interface_iic_init(void)
+{
+    return a_host_open(0);
+}
+
+/**
+ * @brief  interface iic bus deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 iic deinit failed
+ * @note   none
+ */
+uint8_t as5600_interface_iic_deinit(void)
+{
+    return as5600_sim_iic_deinit(&gs_sim[0]);
+}
+
+/**
+ * @brief      interface iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return as5600_sim_iic_read(&gs_sim[0], addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t as5600_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return as5600_sim_iic_write(&gs_sim[0], addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return as5600_sim_iic_read_cmd(&gs_sim[0], addr, buf, len);
+}
+
+/**
+ * @brief     interface iic bus init with the user data
+ * @param[in] *user_data pointer to an as5600_interface_bus_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      the trailing digit of the bus name modulo 4 selects the simulated device,
+ *            names without a digit select device 0
+ */
+uint8_t as5600_interface_iic_init_ex(void *user_data)
+{
+    as5600_interface_bus_t *bus = (as5600_interface_bus_t *)user_data;
+    size_t len;
+    uint8_t index;
+    
+    len = strlen(bus->name);
+    index = 0;
+    if ((len > 0) && (bus->name[len - 1] >= '0') && (bus->name[len - 1] <= '9'))
+    {
+        index = (uint8_t)((bus->name[len - 1] - '0') % HOST_BUS_NUM);
+    }
+    bus->index = index;
+    
+    return a_host_open(index);
+}
+
+/**
+ * @brief     interface iic bus deinit with the user data
+ * @param[in] *user_data pointer to an as5600_interface_bus_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t as5600_interface_iic_deinit_ex(void *user_data)
+{
+    return as5600_sim_iic_deinit(a_host_get_sim(user_data));
+}
+
+/**
+ * @brief      interface iic bus read with the user data
+ * @param[in]  *user_data pointer to an as5600_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read_ex(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return as5600_sim_iic_read(a_host_get_sim(user_data), addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write with the user data
+ * @param[in] *user_data pointer to an as5600_interface_bus_t structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t as5600_interface_iic_write_ex(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return as5600_sim_iic_write(a_host_get_sim(user_data), addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command with the user data
+ * @param[in]  *user_data pointer to an as5600_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read_cmd_ex(void *user_data, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return as5600_sim_iic_read_cmd(a_host_get_sim(user_data), addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus repeated read
+ * @param[in]  *user_data pointer to an as5600_interface_bus_t structure or NULL
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of one read
+ * @param[in]  num read times
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the register address is written once and then num reads of len bytes follow,
+ *             the buffer size must be len * num
+ */
+uint8_t as5600_interface_iic_read_repeat(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    return as5600_sim_iic_read_repeat(a_host_get_sim(user_data), addr, reg, buf, len, num);
+}
+
+/**
+ * @brief      interface iic bus async read
+ * @param[in]  *user_data pointer to an as5600_interface_bus_t structure or NULL
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *done pointer to a completion function
+ * @param[in]  *ctx pointer to the completion context
+ * @return     status code
+ *             - 0 success
+ *             - 1 read start failed
+ * @note       the request is completed by the async bus thread after the modeled 400khz wire time,
+ *             one request is queued at a time
+ */
+uint8_t as5600_interface_iic_read_async(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                        void (*done)(void *ctx, uint8_t res), void *ctx)
+{
+    uint8_t res;
+    
+    (void)pthread_mutex_lock(&gs_mutex);
+    res = 0;
+    if (gs_thread_started == 0)
+    {
+        if (pthread_create(&gs_thread, NULL, a_host_async_thread, NULL) != 0)
+        {
+            res = 1;
+        }
+        else
+        {
+            (void)pthread_detach(gs_thread);
+            gs_thread_started = 1;
+        }
+    }
+    if ((res == 0) && (gs_async.pending == 0))
+    {
+        gs_async.sim = a_host_get_sim(user_data);
+        gs_async.addr = addr;
+        gs_async.reg = reg;
+        gs_async.buf = buf;
+        gs_async.len = len;
+        gs_async.done = done;
+        gs_async.ctx = ctx;
+        gs_async.pending = 1;
+        (void)pthread_cond_signal(&gs_cond);
+    }
+    else
+    {
+        res = 1;
+    }
+    (void)pthread_mutex_unlock(&gs_mutex);
+    
+    return res;
+}
+
+/**
+ * @brief  interface timestamp us
+ * @return free running time in us
+ * @note   the value may wrap, the driver only uses the differences
+ */
+uint32_t as5600_interface_timestamp_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      the host build doesn't sleep, every whole ms is passed to the delay ms
+ */
+void as5600_interface_delay_us(uint32_t us)
+{
+    gs_delay_us += us;
+    if (gs_delay_us >= 1000)
+    {
+        as5600_interface_delay_ms(gs_delay_us / 1000);
+        gs_delay_us %= 1000;
+    }
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      the host build doesn't sleep, the simulated magnets turn by a fixed step per ms instead
+ */
+void as5600_interface_delay_ms(uint32_t ms)
+{
+    int i;
+    
+    (void)pthread_mutex_lock(&gs_mutex);
+    for (i = 0; i < HOST_BUS_NUM; i++)
+    {
+        if (gs_sim_inited[i] != 0)
+        {
+            as5600_sim_set_raw_angle(&gs_sim[i], (uint16_t)((gs_sim[i].raw_angle + ms * HOST_ANGLE_STEP) & 0xFFF));
+        }
+    }
+    (void)pthread_mutex_unlock(&gs_mutex);
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+void as5600_interface_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    memset((char *)str, 0, sizeof(char) * 256); 
+    va_start(args, fmt);
+    vsnprintf((char *)str, 255, (char const *)fmt, args);
+    va_end(args);
+    
+    (void)fputs(str, stdout);
+}
@@ -0,0 +1,412 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      iic_test.c
+ * @brief     iic test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-11-11
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/11/11  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "iic.h"
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <stdarg.h>
+
+/**
+ * @brief iic test definition
+ */
+#define IIC_TEST_MAX_LOG          512         /**< max logged messages */
+#define IIC_TEST_MAX_TRANSFERS    64          /**< max logged transfers */
+#define IIC_TEST_MUX_A            0xE0        /**< first mux write address */
+#define IIC_TEST_MUX_B            0xE2        /**< second mux write address */
+#define IIC_TEST_ADDR             0x6C        /**< as5600 write address */
+#define IIC_TEST_REG              0x0C        /**< raw angle register */
+
+/**
+ * @brief iic test message structure definition
+ */
+typedef struct iic_test_msg_s
+{
+    uint16_t addr;              /**< 7 bits address */
+    uint16_t flags;             /**< message flags */
+    uint16_t len;               /**< message length */
+    uint8_t data;               /**< first written byte */
+    uint8_t *buf;               /**< message buffer */
+} iic_test_msg_t;
+
+static iic_test_msg_t gs_log[IIC_TEST_MAX_LOG];                  /**< message log */
+static uint32_t gs_log_num;                                      /**< logged messages */
+static uint32_t gs_nmsgs[IIC_TEST_MAX_TRANSFERS];                /**< messages of each transfer */
+static uint32_t gs_transfers;                                    /**< logged transfers */
+static uint8_t gs_buf[64][2];                                    /**< read buffers */
+static iic_batch_t gs_batch[64];                                 /**< batch entries */
+static uint8_t gs_repeat[256];                                   /**< repeated read buffer */
+
+/**
+ * @brief     mock ioctl
+ * @param[in] fd iic handle
+ * @param[in] request ioctl request
+ * @return    status code
+ *            - >=0 success
+ *            - -1 failed
+ * @note      logs every I2C_RDWR message, the kernel rejects more than IIC_MAX_MSGS messages
+ */
+int iic_test_ioctl(int fd, unsigned long request, ...)
+{
+    va_list args;
+    struct i2c_rdwr_ioctl_data *data;
+    uint32_t i;
+    
+    (void)fd;
+    va_start(args, request);
+    data = va_arg(args, struct i2c_rdwr_ioctl_data *);
+    va_end(args);
+    if ((request != I2C_RDWR) || (data->nmsgs == 0) || (data->nmsgs > IIC_MAX_MSGS) ||
+        (gs_transfers >= IIC_TEST_MAX_TRANSFERS) || (gs_log_num + data->nmsgs > IIC_TEST_MAX_LOG))
+    {
+        return -1;
+    }
+    gs_nmsgs[gs_transfers] = data->nmsgs;
+    gs_transfers++;
+    for (i = 0; i < data->nmsgs; i++)
+    {
+        gs_log[gs_log_num].addr = data->msgs[i].addr;
+        gs_log[gs_log_num].flags = data->msgs[i].flags;
+        gs_log[gs_log_num].len = data->msgs[i].len;
+        gs_log[gs_log_num].data = ((data->msgs[i].flags & I2C_M_RD) == 0) ? data->msgs[i].buf[0] : 0;
+        gs_log[gs_log_num].buf = data->msgs[i].buf;
+        gs_log_num++;
+    }
+    
+    return (int)data->nmsgs;
+}
+
+/**
+ * @brief iic test log clear
+ * @note  none
+ */
+static void a_iic_test_clear(void)
+{
+    gs_log_num = 0;
+    gs_transfers = 0;
+}
+
+/**
+ * @brief     iic test check
+ * @param[in] *name pointer to a check name
+ * @param[in] ok check result
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_iic_test_check(const char *name, uint8_t ok)
+{
+    (void)printf("iic: check %s %s.\n", name, (ok != 0) ? "ok" : "error");
+    
+    return (ok != 0) ? 0 : 1;
+}
+
+/**
+ * @brief     iic test check a logged write
+ * @param[in] i log index
+ * @param[in] addr iic write address
+ * @param[in] data written byte
+ * @return    1 if the message matches, else 0
+ * @note      none
+ */
+static uint8_t a_iic_test_is_write(uint32_t i, uint8_t addr, uint8_t data)
+{
+    return (uint8_t)((i < gs_log_num) && (gs_log[i].addr == (addr >> 1)) && (gs_log[i].flags == 0) &&
+                     (gs_log[i].len == 1) && (gs_log[i].data == data));
+}
+
+/**
+ * @brief     iic test check a logged read
+ * @param[in] i log index
+ * @param[in] addr iic write address
+ * @param[in] *buf pointer to the expected buffer
+ * @param[in] len expected length
+ * @return    1 if the message matches, else 0
+ * @note      none
+ */
+static uint8_t a_iic_test_is_read(uint32_t i, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return (uint8_t)((i < gs_log_num) && (gs_log[i].addr == (addr >> 1)) && (gs_log[i].flags == I2C_M_RD) &&
+                     (gs_log[i].len == len) && (gs_log[i].buf == buf));
+}
+
+/**
+ * @brief     iic test check the logged transfers
+ * @param[in] *nmsgs pointer to the expected messages of each transfer
+ * @param[in] num expected transfers
+ * @return    1 if the transfers match, else 0
+ * @note      none
+ */
+static uint8_t a_iic_test_is_transfers(const uint32_t *nmsgs, uint32_t num)
+{
+    uint32_t i;
+    uint8_t ok;
+    
+    ok = (uint8_t)(gs_transfers == num);
+    for (i = 0; (i < num) && (ok != 0); i++)
+    {
+        ok = (uint8_t)(gs_nmsgs[i] == nmsgs[i]);
+    }
+    
+    return ok;
+}
+
+/**
+ * @brief     iic test set a batch entry
+ * @param[in] i entry index
+ * @param[in] mux_addr mux write address, 0 means no mux
+ * @param[in] mux_channel mux channel select byte
+ * @note      none
+ */
+static void a_iic_test_entry(uint32_t i, uint8_t mux_addr, uint8_t mux_channel)
+{
+    gs_batch[i].mux_addr = mux_addr;
+    gs_batch[i].mux_channel = mux_channel;
+    gs_batch[i].addr = IIC_TEST_ADDR;
+    gs_batch[i].reg = IIC_TEST_REG;
+    gs_batch[i].buf = gs_buf[i];
+    gs_batch[i].len = 2;
+}
+
+/**
+ * @brief  iic batch test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+static uint8_t a_iic_test_batch(void)
+{
+    const uint32_t mux_sequence[9] = {1, 2, 1, 2, 1, 1, 2, 1, 2};
+    const uint32_t mux_packing[3] = {1, 42, 1};
+    const uint32_t mux_flush[4] = {1, 42, 2, 1};
+    uint8_t ok;
+    uint32_t i;
+    
+    /* mux sequence */
+    (void)printf("iic: iic_read_batch mux test.\n");
+    a_iic_test_entry(0, IIC_TEST_MUX_A, 0x01);
+    a_iic_test_entry(1, IIC_TEST_MUX_A, 0x02);
+    a_iic_test_entry(2, IIC_TEST_MUX_B, 0x01);
+    a_iic_test_entry(3, 0, 0);
+    a_iic_test_clear();
+    if (iic_read_batch(0, gs_batch, 4) != 0)
+    {
+        return 1;
+    }
+    
+    /* every mux write is a transfer of its own, so it ends with the stop the mux switches on */
+    ok = (uint8_t)(a_iic_test_is_transfers(mux_sequence, 9) &&
+                   a_iic_test_is_write(0, IIC_TEST_MUX_A, 0x01) &&
+                   a_iic_test_is_write(1, IIC_TEST_ADDR, IIC_TEST_REG) &&
+                   a_iic_test_is_read(2, IIC_TEST_ADDR, gs_buf[0], 2) &&
+                   a_iic_test_is_write(3, IIC_TEST_MUX_A, 0x02) &&
+                   a_iic_test_is_write(4, IIC_TEST_ADDR, IIC_TEST_REG) &&
+                   a_iic_test_is_read(5, IIC_TEST_ADDR, gs_buf[1], 2) &&
+                   a_iic_test_is_write(6, IIC_TEST_MUX_A, 0x00) &&
+                   a_iic_test_is_write(7, IIC_TEST_MUX_B, 0x01) &&
+                   a_iic_test_is_write(8, IIC_TEST_ADDR, IIC_TEST_REG) &&
+                   a_iic_test_is_read(9, IIC_TEST_ADDR, gs_buf[2], 2) &&
+                   a_iic_test_is_write(10, IIC_TEST_MUX_B, 0x00) &&
+                   a_iic_test_is_write(11, IIC_TEST_ADDR, IIC_TEST_REG) &&
+                   a_iic_test_is_read(12, IIC_TEST_ADDR, gs_buf[3], 2));
+    if (a_iic_test_check("mux deselect sequence", ok) != 0)
+    {
+        return 1;
+    }
+    
+    /* direct packing */
+    (void)printf("iic: iic_read_batch packing test.\n");
+    for (i = 0; i < 22; i++)
+    {
+        a_iic_test_entry(i, 0, 0);
+    }
+    a_iic_test_clear();
+    if (iic_read_batch(0, gs_batch, 21) != 0)
+    {
+        return 1;
+    }
+    ok = (uint8_t)((gs_transfers == 1) && (gs_nmsgs[0] == 42));
+    a_iic_test_clear();
+    if (iic_read_batch(0, gs_batch, 22) != 0)
+    {
+        return 1;
+    }
+    ok &= (uint8_t)((gs_transfers == 2) && (gs_nmsgs[0] == 42) && (gs_nmsgs[1] == 2) &&
+                    a_iic_test_is_write(42, IIC_TEST_ADDR, IIC_TEST_REG) &&
+                    a_iic_test_is_read(43, IIC_TEST_ADDR, gs_buf[21], 2));
+    if (a_iic_test_check("direct packing", ok) != 0)
+    {
+        return 1;
+    }
+    
+    /* mux packing */
+    for (i = 0; i < 22; i++)
+    {
+        a_iic_test_entry(i, IIC_TEST_MUX_A, 0x04);
+    }
+    a_iic_test_clear();
+    if (iic_read_batch(0, gs_batch, 21) != 0)
+    {
+        return 1;
+    }
+    ok = (uint8_t)(a_iic_test_is_transfers(mux_packing, 3) &&
+                   a_iic_test_is_write(0, IIC_TEST_MUX_A, 0x04) &&
+                   a_iic_test_is_write(1, IIC_TEST_ADDR, IIC_TEST_REG) &&
+                   a_iic_test_is_read(42, IIC_TEST_ADDR, gs_buf[20], 2) &&
+                   a_iic_test_is_write(43, IIC_TEST_MUX_A, 0x00));
+    a_iic_test_clear();
+    if (iic_read_batch(0, gs_batch, 22) != 0)
+    {
+        return 1;
+    }
+    ok &= (uint8_t)(a_iic_test_is_transfers(mux_flush, 4) &&
+                    a_iic_test_is_write(0, IIC_TEST_MUX_A, 0x04) &&
+                    a_iic_test_is_write(43, IIC_TEST_ADDR, IIC_TEST_REG) &&
+                    a_iic_test_is_read(44, IIC_TEST_ADDR, gs_buf[21], 2) &&
+                    a_iic_test_is_write(45, IIC_TEST_MUX_A, 0x00));
+    if (a_iic_test_check("mux packing", ok) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     iic repeat test check the reads
+ * @param[in] first log index of the first read
+ * @param[in] num read times
+ * @return    1 if every read follows the previous one in the buffer, else 0
+ * @note      a flush in the middle has no register write, so the reads are consecutive in the log
+ */
+static uint8_t a_iic_test_is_repeat(uint32_t first, uint32_t num)
+{
+    uint32_t i;
+    uint8_t ok;
+    
+    ok = 1;
+    for (i = 0; i < num; i++)
+    {
+        ok &= a_iic_test_is_read(first + i, IIC_TEST_ADDR, &gs_repeat[i * 2], 2);
+    }
+    
+    return ok;
+}
+
+/**
+ * @brief  iic repeat test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+static uint8_t a_iic_test_repeat(void)
+{
+    uint8_t ok;
+    
+    /* one transfer */
+    (void)printf("iic: iic_read_repeat packing test.\n");
+    a_iic_test_clear();
+    if (iic_read_repeat(0, IIC_TEST_ADDR, IIC_TEST_REG, gs_repeat, 2, 41) != 0)
+    {
+        return 1;
+    }
+    ok = (uint8_t)((gs_transfers == 1) && (gs_nmsgs[0] == 42) && (gs_log_num == 42) &&
+                   a_iic_test_is_write(0, IIC_TEST_ADDR, IIC_TEST_REG) &&
+                   a_iic_test_is_repeat(1, 41));
+    if (a_iic_test_check("41 reads in one transfer", ok) != 0)
+    {
+        return 1;
+    }
+    
+    /* one more read */
+    a_iic_test_clear();
+    if (iic_read_repeat(0, IIC_TEST_ADDR, IIC_TEST_REG, gs_repeat, 2, 42) != 0)
+    {
+        return 1;
+    }
+    ok = (uint8_t)((gs_transfers == 2) && (gs_nmsgs[0] == 42) && (gs_nmsgs[1] == 1) && (gs_log_num == 43) &&
+                   a_iic_test_is_write(0, IIC_TEST_ADDR, IIC_TEST_REG) &&
+                   a_iic_test_is_repeat(1, 42));
+    if (a_iic_test_check("42 reads in two transfers", ok) != 0)
+    {
+        return 1;
+    }
+    
+    /* several transfers */
+    a_iic_test_clear();
+    if (iic_read_repeat(0, IIC_TEST_ADDR, IIC_TEST_REG, gs_repeat, 2, 100) != 0)
+    {
+        return 1;
+    }
+    ok = (uint8_t)((gs_transfers == 3) && (gs_nmsgs[0] == 42) && (gs_nmsgs[1] == 42) && (gs_nmsgs[2] == 17) &&
+                   (gs_log_num == 101) && a_iic_test_is_write(0, IIC_TEST_ADDR, IIC_TEST_REG) &&
+                   a_iic_test_is_repeat(1, 100));
+    if (a_iic_test_check("100 reads in three transfers", ok) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the iic functions of the linux port run against the mock ioctl
+ */
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    
+    if (a_iic_test_batch() != 0)
+    {
+        return 1;
+    }
+    if (a_iic_test_repeat() != 0)
+    {
+        return 1;
+    }
+    (void)printf("iic: finish iic test.\n");
+    
+    return 0;
+}
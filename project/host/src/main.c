@@ -0,0 +1,574 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main.c
+ * @brief     main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-09-30
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/09/30  <td>1.0      <td>Shifeng Li  <td>format the code
+ * </table>
+ */
+
+#include "driver_as5600_register_test.h"
+#include "driver_as5600_read_test.h"
+#include "driver_as5600_burst_test.h"
+#include "driver_as5600_sim_test.h"
+#include "driver_as5600_basic.h"
+#include <getopt.h>
+#include <stdlib.h>
+#if defined(__linux__)
+#include "sampler.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief stream ring size definition
+ */
+#define STREAM_RING_SIZE 4096        /**< samples the stream ring holds while the output catches up */
+#define STREAM_BATCH     64          /**< binary frames written at once */
+
+#if defined(__linux__)
+/**
+ * @brief stream variable definition
+ */
+static as5600_sample_t gs_ring_buf[STREAM_RING_SIZE];        /**< stream ring buffer */
+static as5600_ring_t gs_ring;                                /**< stream ring */
+
+/**
+ * @brief     stream sample function
+ * @param[in] *arg pointer to an as5600 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sample failed
+ * @note      runs on the sampler thread
+ */
+static uint8_t a_stream_sample(void *arg)
+{
+    return as5600_basic_sample((as5600_ring_t *)arg);
+}
+
+/**
+ * @brief     stream print format data to the stderr
+ * @param[in] fmt format data
+ * @note      keeps the stdout free for the binary frames
+ */
+static void a_stream_error_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+#endif
+/**
+ * @brief     as5600 full function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      none
+ */
+uint8_t as5600(uint8_t argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "hipe:t:";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"information", no_argument, NULL, 'i'},
+        {"port", no_argument, NULL, 'p'},
+        {"example", required_argument, NULL, 'e'},
+        {"test", required_argument, NULL, 't'},
+        {"times", required_argument, NULL, 1},
+        {"rate", required_argument, NULL, 2},
+        {"priority", required_argument, NULL, 3},
+        {"cpu", required_argument, NULL, 4},
+        {"format", required_argument, NULL, 5},
+        {NULL, 0, NULL, 0},
+    };
+    char type[33] = "unknown";
+    uint32_t times = 3;
+    uint32_t rate = 1000;
+    int priority = 0;
+    int cpu = -1;
+    uint8_t binary = 0;
+    
+    /* if no params */
+    if (argc == 1)
+    {
+        /* goto the help */
+        goto help;
+    }
+    
+    /* init 0 */
+    optind = 0;
+    
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "h");
+                
+                break;
+            }
+            
+            /* information */
+            case 'i' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "i");
+                
+                break;
+            }
+            
+            /* port */
+            case 'p' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "p");
+                
+                break;
+            }
+            
+            /* example */
+            case 'e' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "e_%s", optarg);
+                
+                break;
+            }
+            
+            /* test */
+            case 't' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "t_%s", optarg);
+                
+                break;
+            }
+
+            /* running times */
+            case 1 :
+            {
+                /* set the times */
+                times = atol(optarg);
+                
+                break;
+            } 
+            
+            /* sample rate */
+            case 2 :
+            {
+                /* set the rate */
+                rate = atol(optarg);
+                
+                break;
+            } 
+            
+            /* real time priority */
+            case 3 :
+            {
+                /* set the priority */
+                priority = atoi(optarg);
+                
+                break;
+            } 
+            
+            /* cpu affinity */
+            case 4 :
+            {
+                /* set the cpu */
+                cpu = atoi(optarg);
+                
+                break;
+            } 
+            
+            /* stream format */
+            case 5 :
+            {
+                /* set the format */
+                if (strcmp("binary", optarg) == 0)
+                {
+                    binary = 1;
+                }
+                else if (strcmp("text", optarg) == 0)
+                {
+                    binary = 0;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            } 
+            
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+            
+            /* others */
+            default :
+            {
+                return 5;
+            }
+        }
+    } while (c != -1);
+
+    /* run the function */
+    if (strcmp("t_reg", type) == 0)
+    {
+        /* run reg test */
+        if (as5600_register_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_read", type) == 0)
+    {
+        /* run read test */
+        if (as5600_read_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_burst", type) == 0)
+    {
+        /* run burst test */
+        if (as5600_burst_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_sim", type) == 0)
+    {
+        /* run sim test */
+        if (as5600_sim_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("e_read", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        
+        /* basic init */
+        res = as5600_basic_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+#if (AS5600_FLOAT_ENABLE == 1)
+            float deg;
+            
+            /* read data */
+            res = as5600_basic_read(&deg);
+#else
+            int32_t deg_q16;
+            
+            /* read data */
+            res = as5600_basic_read_fixed(AS5600_FIXED_FORMAT_DEG_Q16, &deg_q16);
+#endif
+            if (res != 0)
+            {
+                (void)as5600_basic_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            as5600_interface_debug_print("as5600: %d/%d.\n", i + 1, times);
+            
+            /* output */
+#if (AS5600_FLOAT_ENABLE == 1)
+            as5600_interface_debug_print("as5600: angle is %.2f.\n", deg);
+#else
+            as5600_interface_debug_print("as5600: angle is %d.%02d.\n", (int)(deg_q16 >> 16), (int)(((deg_q16 & 0xFFFF) * 100) >> 16));
+#endif
+            
+            /* delay 1000ms */
+            as5600_interface_delay_ms(1000);
+        }
+        
+        /* deinit */
+        (void)as5600_basic_deinit();
+        
+        return 0;
+    }
+#if defined(__linux__)
+    else if (strcmp("e_stream", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        uint32_t idle;
+        uint32_t count;
+        uint32_t dropped;
+        uint32_t n;
+        as5600_sample_t sample;
+        sampler_config_t config;
+        sampler_stats_t stats;
+        uint8_t frames[STREAM_BATCH * AS5600_STREAM_FRAME_SIZE];
+        void (*print)(const char *const fmt, ...);
+        
+        /* the binary frames own the stdout */
+        print = (binary != 0) ? a_stream_error_print : as5600_interface_debug_print;
+        
+        /* basic init */
+        res = as5600_basic_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* start the sampler, it fills the ring at the rate on its own thread */
+        (void)as5600_ring_init(&gs_ring, gs_ring_buf, STREAM_RING_SIZE);
+        config.rate_hz = rate;
+        config.priority = priority;
+        config.cpu = cpu;
+        config.lock_memory = (priority > 0) ? 1 : 0;
+        res = sampler_start(&config, a_stream_sample, &gs_ring);
+        if (res == 4)
+        {
+            print("as5600: sampler cpu %d affinity failed.\n", cpu);
+            (void)as5600_basic_deinit();
+            
+            return 1;
+        }
+        if (res != 0)
+        {
+            print("as5600: sampler start failed.\n");
+            (void)as5600_basic_deinit();
+            
+            return 1;
+        }
+        
+        /* drain the ring, the output never blocks the sampler */
+        i = 0;
+        idle = 0;
+        while ((i < times) && (idle < 1000))
+        {
+            n = 0;
+            while ((i < times) && (n < STREAM_BATCH) && (as5600_ring_pop(&gs_ring, &sample) == 0))
+            {
+                if (binary != 0)
+                {
+                    /* the producer sequence skips over the dropped samples and lets the decoder count them */
+                    (void)as5600_stream_encode(&sample, sample.sequence, &frames[n * AS5600_STREAM_FRAME_SIZE]);
+                }
+                else
+                {
+                    as5600_interface_debug_print("as5600: %u us raw angle is %d and status is 0x%02X.\n",
+                                                 (unsigned int)sample.timestamp_us, sample.raw_angle, sample.status);
+                }
+                i++;
+                n++;
+            }
+            if (n != 0)
+            {
+                idle = 0;
+                if (binary != 0)
+                {
+                    (void)fwrite(frames, AS5600_STREAM_FRAME_SIZE, n, stdout);
+                    (void)fflush(stdout);
+                }
+            }
+            else
+            {
+                /* wait 1ms for the sampler */
+                idle++;
+                usleep(1000);
+            }
+        }
+        
+        /* stop the sampler */
+        (void)sampler_stop(&stats);
+        (void)as5600_ring_get_count(&gs_ring, &count, &dropped);
+        (void)as5600_basic_deinit();
+        
+        /* output the stats */
+        print("as5600: %llu samples in %llu periods at %u hz.\n",
+              (unsigned long long)stats.samples, (unsigned long long)stats.periods, (unsigned int)rate);
+        print("as5600: %llu overruns, %llu failures and %u dropped samples.\n",
+              (unsigned long long)stats.overruns, (unsigned long long)stats.failures, (unsigned int)dropped);
+        if (stats.samples != 0)
+        {
+            print("as5600: wake up latency min is %lld ns, max is %lld ns and mean is %lld ns.\n",
+                  (long long)stats.latency_min_ns, (long long)stats.latency_max_ns,
+                  (long long)(stats.latency_total_ns / (int64_t)stats.samples));
+        }
+        print("as5600: SCHED_FIFO is %s and memory lock is %s.\n",
+              (stats.realtime != 0) ? "on" : "off", (stats.locked != 0) ? "on" : "off");
+        if ((i < times) || (stats.failures != 0))
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+#endif
+    else if (strcmp("h", type) == 0)
+    {
+        help:
+        as5600_interface_debug_print("Usage:\n");
+        as5600_interface_debug_print("  as5600 (-i | --information)\n");
+        as5600_interface_debug_print("  as5600 (-h | --help)\n");
+        as5600_interface_debug_print("  as5600 (-p | --port)\n");
+        as5600_interface_debug_print("  as5600 (-t reg | --test=reg)\n");
+        as5600_interface_debug_print("  as5600 (-t read | --test=read) [--times=<num>]\n");
+        as5600_interface_debug_print("  as5600 (-t burst | --test=burst) [--times=<num>]\n");
+        as5600_interface_debug_print("  as5600 (-t sim | --test=sim) [--times=<num>]\n");
+        as5600_interface_debug_print("  as5600 (-e read | --example=read) [--times=<num>]\n");
+        as5600_interface_debug_print("  as5600 (-e stream | --example=stream) [--times=<num>] [--rate=<hz>] [--priority=<num>] [--cpu=<num>]\n");
+        as5600_interface_debug_print("         [--format=<text | binary>]\n");
+        as5600_interface_debug_print("\n");
+        as5600_interface_debug_print("Options:\n");
+        as5600_interface_debug_print("  -e <read | stream>, --example=<read | stream>\n");
+        as5600_interface_debug_print("                                          Run the driver example.\n");
+        as5600_interface_debug_print("  -h, --help                              Show the help.\n");
+        as5600_interface_debug_print("  -i, --information                       Show the chip information.\n");
+        as5600_interface_debug_print("  -p, --port                              Display the pin connections of the current board.\n");
+        as5600_interface_debug_print("  -t <reg | read | burst | sim>, --test=<reg | read | burst | sim>\n");
+        as5600_interface_debug_print("                                          Run the driver test.\n");
+        as5600_interface_debug_print("      --times=<num>                       Set the running times.([default: 3])\n");
+        as5600_interface_debug_print("      --rate=<hz>                         Set the stream sample rate.([default: 1000])\n");
+        as5600_interface_debug_print("      --priority=<num>                    Set the stream SCHED_FIFO priority and lock the memory.([default: 0])\n");
+        as5600_interface_debug_print("      --cpu=<num>                         Set the stream sampler cpu.([default: any])\n");
+        as5600_interface_debug_print("      --format=<text | binary>            Set the stream output, binary writes the stream frames to the stdout.([default: text])\n");
+        
+        return 0;
+    }
+    else if (strcmp("i", type) == 0)
+    {
+        as5600_info_t info;
+        
+        /* print as5600 info */
+        as5600_info(&info);
+        as5600_interface_debug_print("as5600: chip is %s.\n", info.chip_name);
+        as5600_interface_debug_print("as5600: manufacturer is %s.\n", info.manufacturer_name);
+        as5600_interface_debug_print("as5600: interface is %s.\n", info.interface);
+        as5600_interface_debug_print("as5600: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        as5600_interface_debug_print("as5600: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        as5600_interface_debug_print("as5600: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        as5600_interface_debug_print("as5600: max current is %0.2fmA.\n", info.max_current_ma);
+        as5600_interface_debug_print("as5600: max temperature is %0.1fC.\n", info.temperature_max);
+        as5600_interface_debug_print("as5600: min temperature is %0.1fC.\n", info.temperature_min);
+        
+        return 0;
+    }
+    else if (strcmp("p", type) == 0)
+    {
+        /* print the bus */
+        as5600_interface_debug_print("as5600: host build uses the software device model as the iic bus.\n");
+        
+        return 0;
+    }
+    else
+    {
+        return 5;
+    }
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 5 param is invalid
+ * @note      the status code is returned to the shell so that ctest sees the failures
+ */
+int main(uint8_t argc, char **argv)
+{
+    uint8_t res;
+
+    res = as5600(argc, argv);
+    if (res == 0)
+    {
+        /* run success */
+    }
+    else if (res == 1)
+    {
+        as5600_interface_debug_print("as5600: run failed.\n");
+    }
+    else if (res == 5)
+    {
+        as5600_interface_debug_print("as5600: param is invalid.\n");
+    }
+    else
+    {
+        as5600_interface_debug_print("as5600: unknown status code.\n");
+    }
+
+    return res;
+}
@@ -34,20 +34,76 @@
  * </table>
  */
 
-#include "driver_as5600_interface.h"
+#include "raspberrypi4b_driver_as5600_interface.h"
 #include "iic.h"
+#include <pthread.h>
 #include <stdarg.h>
+#include <time.h>
 
 /**
  * @brief iic device name definition
  */
 #define IIC_DEVICE_NAME "/dev/i2c-1"        /**< iic device name */
 
+/**
+ * @brief async request structure definition
+ */
+typedef struct raspberrypi4b_async_s
+{
+    int fd;                                    /**< iic handle */
+    uint8_t addr;                              /**< iic device write address */
+    uint8_t reg;                               /**< iic register address */
+    uint8_t *buf;                              /**< data buffer */
+    uint16_t len;                              /**< data length */
+    void (*done)(void *ctx, uint8_t res);      /**< completion function */
+    void *ctx;                                 /**< completion context */
+    uint8_t pending;                           /**< request pending flag */
+} raspberrypi4b_async_t;
+
 /**
  * @brief iic device handle definition
  */
 static int gs_fd;                           /**< iic handle */
 
+/**
+ * @brief async read variable definition
+ */
+static pthread_mutex_t gs_mutex = PTHREAD_MUTEX_INITIALIZER;        /**< async request lock */
+static pthread_cond_t gs_cond = PTHREAD_COND_INITIALIZER;           /**< async request condition */
+static pthread_t gs_thread;                                         /**< async read thread */
+static uint8_t gs_thread_started;                                   /**< async read thread started flag */
+static raspberrypi4b_async_t gs_async;                              /**< async request */
+
+/**
+ * @brief     async read thread
+ * @param[in] *arg unused
+ * @return    never returns
+ * @note      every request is read from the iic device and completed from this thread
+ */
+static void *a_raspberrypi4b_async_thread(void *arg)
+{
+    raspberrypi4b_async_t req;
+    uint8_t res;
+    
+    (void)arg;
+    while (1)
+    {
+        (void)pthread_mutex_lock(&gs_mutex);
+        while (gs_async.pending == 0)
+        {
+            (void)pthread_cond_wait(&gs_cond, &gs_mutex);
+        }
+        req = gs_async;
+        res = iic_read(req.fd, req.addr, req.reg, req.buf, req.len);
+        gs_async.pending = 0;
+        (void)pthread_mutex_unlock(&gs_mutex);
+        
+        req.done(req.ctx, res);
+    }
+    
+    return NULL;
+}
+
 /**
  * @brief  interface iic bus init
  * @return status code
@@ -69,7 +125,14 @@ uint8_t as5600_interface_iic_init(void)
  */
 uint8_t as5600_interface_iic_deinit(void)
 {
-    return iic_deinit(gs_fd);
+    uint8_t res;
+    
+    /* an async read in flight holds the lock */
+    (void)pthread_mutex_lock(&gs_mutex);
+    res = iic_deinit(gs_fd);
+    (void)pthread_mutex_unlock(&gs_mutex);
+    
+    return res;
 }
 
 /**
@@ -104,6 +167,208 @@ uint8_t as5600_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint
     return iic_write(gs_fd, addr, reg, buf, len);
 }
 
+/**
+ * @brief      interface iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return iic_read_cmd(gs_fd, addr, buf, len);
+}
+
+/**
+ * @brief     interface iic bus init with the user data
+ * @param[in] *user_data pointer to an as5600_interface_bus_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
+ */
+uint8_t as5600_interface_iic_init_ex(void *user_data)
+{
+    as5600_interface_bus_t *bus = (as5600_interface_bus_t *)user_data;
+    
+    return iic_init(bus->name, &bus->fd);
+}
+
+/**
+ * @brief     interface iic bus deinit with the user data
+ * @param[in] *user_data pointer to an as5600_interface_bus_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t as5600_interface_iic_deinit_ex(void *user_data)
+{
+    as5600_interface_bus_t *bus = (as5600_interface_bus_t *)user_data;
+    
+    return iic_deinit(bus->fd);
+}
+
+/**
+ * @brief      interface iic bus read with the user data
+ * @param[in]  *user_data pointer to an as5600_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read_ex(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    as5600_interface_bus_t *bus = (as5600_interface_bus_t *)user_data;
+    
+    return iic_read(bus->fd, addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write with the user data
+ * @param[in] *user_data pointer to an as5600_interface_bus_t structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t as5600_interface_iic_write_ex(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    as5600_interface_bus_t *bus = (as5600_interface_bus_t *)user_data;
+    
+    return iic_write(bus->fd, addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command with the user data
+ * @param[in]  *user_data pointer to an as5600_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read_cmd_ex(void *user_data, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    as5600_interface_bus_t *bus = (as5600_interface_bus_t *)user_data;
+    
+    return iic_read_cmd(bus->fd, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus repeated read
+ * @param[in]  *user_data pointer to an as5600_interface_bus_t structure or NULL
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of one read
+ * @param[in]  num read times
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the register address is written once and then num reads of len bytes follow,
+ *             the buffer size must be len * num
+ */
+uint8_t as5600_interface_iic_read_repeat(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    as5600_interface_bus_t *bus = (as5600_interface_bus_t *)user_data;
+    
+    return iic_read_repeat((bus != NULL) ? bus->fd : gs_fd, addr, reg, buf, len, num);
+}
+
+/**
+ * @brief      interface iic bus async read
+ * @param[in]  *user_data pointer to an as5600_interface_bus_t structure or NULL
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *done pointer to a completion function
+ * @param[in]  *ctx pointer to the completion context
+ * @return     status code
+ *             - 0 success
+ *             - 1 read start failed
+ * @note       the linux iic device has no completion interrupt, so the read runs on the async read thread
+ *             and done is called from that thread, one request is queued at a time
+ */
+uint8_t as5600_interface_iic_read_async(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                        void (*done)(void *ctx, uint8_t res), void *ctx)
+{
+    as5600_interface_bus_t *bus = (as5600_interface_bus_t *)user_data;
+    uint8_t res;
+    
+    (void)pthread_mutex_lock(&gs_mutex);
+    res = 0;
+    if (gs_thread_started == 0)
+    {
+        if (pthread_create(&gs_thread, NULL, a_raspberrypi4b_async_thread, NULL) != 0)
+        {
+            res = 1;
+        }
+        else
+        {
+            (void)pthread_detach(gs_thread);
+            gs_thread_started = 1;
+        }
+    }
+    if ((res == 0) && (gs_async.pending == 0))
+    {
+        gs_async.fd = (bus != NULL) ? bus->fd : gs_fd;
+        gs_async.addr = addr;
+        gs_async.reg = reg;
+        gs_async.buf = buf;
+        gs_async.len = len;
+        gs_async.done = done;
+        gs_async.ctx = ctx;
+        gs_async.pending = 1;
+        (void)pthread_cond_signal(&gs_cond);
+    }
+    else
+    {
+        res = 1;
+    }
+    (void)pthread_mutex_unlock(&gs_mutex);
+    
+    return res;
+}
+
+/**
+ * @brief  interface timestamp us
+ * @return free running time in us
+ * @note   the value may wrap, the driver only uses the differences
+ */
+uint32_t as5600_interface_timestamp_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void as5600_interface_delay_us(uint32_t us)
+{
+    usleep(us);
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
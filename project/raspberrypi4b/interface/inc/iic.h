@@ -53,6 +53,24 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief iic max messages in one transfer definition
+ */
+#define IIC_MAX_MSGS 42        /**< kernel I2C_RDWR_IOCTL_MAX_MSGS */
+
+/**
+ * @brief iic batch structure definition
+ */
+typedef struct iic_batch_s
+{
+    uint8_t mux_addr;           /**< mux write address, 0 means no mux */
+    uint8_t mux_channel;        /**< mux channel select byte */
+    uint8_t addr;               /**< iic device write address */
+    uint8_t reg;                /**< iic register address */
+    uint8_t *buf;               /**< pointer to a data buffer */
+    uint16_t len;               /**< length of the data buffer */
+} iic_batch_t;
+
 /**
  * @brief      iic bus init
  * @param[in]  *name pointer to an iic device name buffer
@@ -156,6 +174,40 @@ uint8_t iic_write(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
  */
 uint8_t iic_write_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief     iic bus batch read
+ * @param[in] fd iic handle
+ * @param[in] *batch pointer to a batch array
+ * @param[in] num batch array length
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      addr = device_address_7bits << 1,
+ *            a mux only switches its channel on a stop, so every mux select or deselect is sent
+ *            as its own I2C_RDWR transfer and only the reads behind one mux state are packed together,
+ *            as many as the IIC_MAX_MSGS limit allows, the mux is only selected when its address or channel changes,
+ *            a selected mux is set to 0x00 before another mux or a direct device is used and at the end,
+ *            so devices with the same address on different muxes never answer together
+ */
+uint8_t iic_read_batch(int fd, iic_batch_t *batch, uint32_t num);
+
+/**
+ * @brief      iic bus repeated read
+ * @param[in]  fd iic handle
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of one read
+ * @param[in]  num read times
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1,
+ *             the register address is written once and then num reads of len bytes are packed
+ *             into as few I2C_RDWR transfers as the IIC_MAX_MSGS limit allows
+ */
+uint8_t iic_read_repeat(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, uint32_t num);
+
 /**
  * @}
  */
@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sampler.h
+ * @brief     sampler header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-11-11
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/11/11  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SAMPLER_H
+#define SAMPLER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sampler sampler function
+ * @brief    sampler function modules
+ * @{
+ */
+
+/**
+ * @brief sampler config structure definition
+ */
+typedef struct sampler_config_s
+{
+    uint32_t rate_hz;            /**< sample rate in hz */
+    int priority;                /**< SCHED_FIFO priority, 0 keeps the normal scheduler */
+    int cpu;                     /**< cpu of the sampler thread, -1 keeps all cpus */
+    uint8_t lock_memory;         /**< lock all pages with mlockall */
+} sampler_config_t;
+
+/**
+ * @brief sampler stats structure definition
+ */
+typedef struct sampler_stats_s
+{
+    uint64_t periods;            /**< elapsed periods */
+    uint64_t samples;            /**< sample function calls */
+    uint64_t overruns;           /**< periods skipped because the last sample ran past them */
+    uint64_t failures;           /**< failed sample function calls */
+    int64_t latency_min_ns;      /**< min wake up latency in ns */
+    int64_t latency_max_ns;      /**< max wake up latency in ns */
+    int64_t latency_total_ns;    /**< total wake up latency in ns, the mean is latency_total_ns / samples */
+    uint8_t realtime;            /**< SCHED_FIFO granted flag */
+    uint8_t locked;              /**< mlockall granted flag */
+} sampler_stats_t;
+
+/**
+ * @brief     sampler start
+ * @param[in] *config pointer to a sampler config structure
+ * @param[in] *sample pointer to a sample function
+ * @param[in] *arg pointer to the sample function argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 config is invalid
+ *            - 3 sampler is running
+ *            - 4 cpu affinity failed
+ * @note      the sample function runs once per period on its own thread at absolute deadlines,
+ *            so the period doesn't drift with the sample time, a period the last sample ran past is
+ *            skipped and counted as an overrun, SCHED_FIFO and mlockall fall back quietly without the privilege,
+ *            the cpu is set on the thread attributes so the thread never runs off its cpu
+ */
+uint8_t sampler_start(const sampler_config_t *config, uint8_t (*sample)(void *arg), void *arg);
+
+/**
+ * @brief      sampler stop
+ * @param[out] *stats pointer to a sampler stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 stop failed
+ * @note       waits for the sampler thread and returns the stats of the whole run
+ */
+uint8_t sampler_stop(sampler_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -40,6 +40,16 @@
 #include <sys/ioctl.h>
 #include <fcntl.h>
 
+/**
+ * @brief iic ioctl definition
+ * @note  a test build sets it to a stub with the ioctl prototype to check the messages
+ */
+#ifndef IIC_IOCTL
+    #define IIC_IOCTL ioctl
+#else
+    int IIC_IOCTL(int fd, unsigned long request, ...);
+#endif
+
 /**
  * @brief      iic bus init
  * @param[in]  *name pointer to an iic device name buffer
@@ -121,7 +131,7 @@ uint8_t iic_read_cmd(int fd, uint8_t addr, uint8_t *buf, uint16_t len)
     i2c_rdwr_data.nmsgs = 1;
     
     /* transmit */
-    if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+    if (IIC_IOCTL(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
     {
         perror("iic: read failed.\n");
         
@@ -167,7 +177,7 @@ uint8_t iic_read(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
     i2c_rdwr_data.nmsgs = 2;
     
     /* transmit */
-    if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+    if (IIC_IOCTL(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
     {
         perror("iic: read failed.\n");
         
@@ -216,7 +226,7 @@ uint8_t iic_read_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, uin
     i2c_rdwr_data.nmsgs = 2;
     
     /* transmit */
-    if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+    if (IIC_IOCTL(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
     {
         perror("iic: read failed.\n");
         
@@ -257,7 +267,7 @@ uint8_t iic_write_cmd(int fd, uint8_t addr, uint8_t *buf, uint16_t len)
     i2c_rdwr_data.nmsgs = 1;
     
     /* transmit */
-    if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+    if (IIC_IOCTL(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
     {
         perror("iic: write failed.\n");
         
@@ -305,7 +315,7 @@ uint8_t iic_write(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
     i2c_rdwr_data.nmsgs = 1;
     
     /* transmit */
-    if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+    if (IIC_IOCTL(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
     {
         perror("iic: write failed.\n");
         
@@ -354,7 +364,7 @@ uint8_t iic_write_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, ui
     i2c_rdwr_data.nmsgs = 1;
     
     /* transmit */
-    if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+    if (IIC_IOCTL(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
     {
         perror("iic: write failed.\n");
         
@@ -363,3 +373,184 @@ uint8_t iic_write_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, ui
      
     return 0;
 }
+
+/**
+ * @brief     iic bus batch read
+ * @param[in] fd iic handle
+ * @param[in] *batch pointer to a batch array
+ * @param[in] num batch array length
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      addr = device_address_7bits << 1,
+ *            a mux only switches its channel on a stop, so every mux select or deselect is sent
+ *            as its own I2C_RDWR transfer and only the reads behind one mux state are packed together,
+ *            as many as the IIC_MAX_MSGS limit allows, the mux is only selected when its address or channel changes,
+ *            a selected mux is set to 0x00 before another mux or a direct device is used and at the end,
+ *            so devices with the same address on different muxes never answer together
+ */
+uint8_t iic_read_batch(int fd, iic_batch_t *batch, uint32_t num)
+{
+    struct i2c_rdwr_ioctl_data i2c_rdwr_data;
+    struct i2c_msg msgs[IIC_MAX_MSGS];
+    uint32_t i;
+    uint32_t n;
+    uint8_t mux_addr;
+    uint8_t mux_channel;
+    uint8_t mux_off;
+    
+    /* clear msgs data */
+    memset(msgs, 0, sizeof(struct i2c_msg) * IIC_MAX_MSGS);
+    
+    /* no mux is selected, 0 means no mux */
+    mux_addr = 0;
+    mux_channel = 0;
+    mux_off = 0x00;
+    
+    n = 0;
+    for (i = 0; i < num; i++)
+    {
+        uint8_t deselect;
+        uint8_t select;
+        
+        /* check if the selected mux must be closed and if the mux must be selected */
+        deselect = (uint8_t)((mux_addr != 0) && (mux_addr != batch[i].mux_addr));
+        select = (uint8_t)((batch[i].mux_addr != 0) &&
+                           ((mux_addr != batch[i].mux_addr) || (mux_channel != batch[i].mux_channel)));
+        
+        /* flush the queued reads before the mux state changes or when the messages are full */
+        if ((n != 0) && ((deselect != 0) || (select != 0) || (n + 2 > IIC_MAX_MSGS)))
+        {
+            memset(&i2c_rdwr_data, 0, sizeof(struct i2c_rdwr_ioctl_data));
+            i2c_rdwr_data.msgs = msgs;
+            i2c_rdwr_data.nmsgs = n;
+            if (IIC_IOCTL(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+            {
+                perror("iic: read batch failed.\n");
+                
+                return 1;
+            }
+            memset(msgs, 0, sizeof(struct i2c_msg) * IIC_MAX_MSGS);
+            n = 0;
+        }
+        
+        /* close the selected mux, the write ends with a stop */
+        if (deselect != 0)
+        {
+            if (iic_write_cmd(fd, mux_addr, &mux_off, 1) != 0)
+            {
+                return 1;
+            }
+            mux_addr = 0;
+            mux_channel = 0;
+        }
+        
+        /* select the mux channel, the write ends with a stop */
+        if (select != 0)
+        {
+            if (iic_write_cmd(fd, batch[i].mux_addr, &batch[i].mux_channel, 1) != 0)
+            {
+                return 1;
+            }
+            mux_addr = batch[i].mux_addr;
+            mux_channel = batch[i].mux_channel;
+        }
+        
+        /* set the register and read */
+        msgs[n].addr = batch[i].addr >> 1;
+        msgs[n].flags = 0;
+        msgs[n].buf = &batch[i].reg;
+        msgs[n].len = 1;
+        n++;
+        msgs[n].addr = batch[i].addr >> 1;
+        msgs[n].flags = I2C_M_RD;
+        msgs[n].buf = batch[i].buf;
+        msgs[n].len = batch[i].len;
+        n++;
+    }
+    
+    /* transmit the rest */
+    if (n != 0)
+    {
+        memset(&i2c_rdwr_data, 0, sizeof(struct i2c_rdwr_ioctl_data));
+        i2c_rdwr_data.msgs = msgs;
+        i2c_rdwr_data.nmsgs = n;
+        if (IIC_IOCTL(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+        {
+            perror("iic: read batch failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* close the mux at the end */
+    if (mux_addr != 0)
+    {
+        if (iic_write_cmd(fd, mux_addr, &mux_off, 1) != 0)
+        {
+            return 1;
+        }
+    }
+     
+    return 0;
+}
+
+/**
+ * @brief      iic bus repeated read
+ * @param[in]  fd iic handle
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of one read
+ * @param[in]  num read times
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1,
+ *             the register address is written once and then num reads of len bytes are packed
+ *             into as few I2C_RDWR transfers as the IIC_MAX_MSGS limit allows
+ */
+uint8_t iic_read_repeat(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, uint32_t num)
+{
+    struct i2c_rdwr_ioctl_data i2c_rdwr_data;
+    struct i2c_msg msgs[IIC_MAX_MSGS];
+    uint32_t i;
+    uint32_t n;
+    
+    /* clear msgs data */
+    memset(msgs, 0, sizeof(struct i2c_msg) * IIC_MAX_MSGS);
+    
+    /* set the register address once */
+    msgs[0].addr = addr >> 1;
+    msgs[0].flags = 0;
+    msgs[0].buf = &reg;
+    msgs[0].len = 1;
+    n = 1;
+    
+    for (i = 0; i < num; i++)
+    {
+        /* add one read */
+        msgs[n].addr = addr >> 1;
+        msgs[n].flags = I2C_M_RD;
+        msgs[n].buf = buf + (size_t)i * len;
+        msgs[n].len = len;
+        n++;
+        
+        /* transmit when the messages are full or at the end */
+        if ((n == IIC_MAX_MSGS) || (i == num - 1))
+        {
+            memset(&i2c_rdwr_data, 0, sizeof(struct i2c_rdwr_ioctl_data));
+            i2c_rdwr_data.msgs = msgs;
+            i2c_rdwr_data.nmsgs = n;
+            if (IIC_IOCTL(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+            {
+                perror("iic: read repeat failed.\n");
+                
+                return 1;
+            }
+            n = 0;
+        }
+    }
+     
+    return 0;
+}
@@ -0,0 +1,271 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sampler.c
+ * @brief     sampler source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-11-11
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/11/11  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "sampler.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+/**
+ * @brief sampler variable definition
+ */
+static pthread_t gs_thread;                       /**< sampler thread */
+static uint8_t gs_running;                        /**< sampler running flag */
+static uint8_t gs_started;                        /**< sampler thread started flag */
+static uint64_t gs_period_ns;                     /**< sample period in ns */
+static uint8_t (*gs_sample)(void *arg);           /**< sample function */
+static void *gs_arg;                              /**< sample function argument */
+static sampler_stats_t gs_stats;                  /**< sampler stats */
+
+/**
+ * @brief         add ns to a time
+ * @param[in,out] *ts pointer to a time
+ * @param[in]     ns added ns
+ * @note          none
+ */
+static void a_sampler_add(struct timespec *ts, uint64_t ns)
+{
+    ns += (uint64_t)ts->tv_nsec;
+    ts->tv_sec += (time_t)(ns / 1000000000ULL);
+    ts->tv_nsec = (long)(ns % 1000000000ULL);
+}
+
+/**
+ * @brief     get the difference of two times
+ * @param[in] *a pointer to the later time
+ * @param[in] *b pointer to the earlier time
+ * @return    a - b in ns
+ * @note      none
+ */
+static int64_t a_sampler_diff(const struct timespec *a, const struct timespec *b)
+{
+    return (int64_t)(a->tv_sec - b->tv_sec) * 1000000000LL + (int64_t)(a->tv_nsec - b->tv_nsec);
+}
+
+/**
+ * @brief     sampler thread
+ * @param[in] *arg unused
+ * @return    NULL
+ * @note      none
+ */
+static void *a_sampler_thread(void *arg)
+{
+    struct timespec next;
+    struct timespec now;
+    int64_t latency;
+    int res;
+    
+    (void)arg;
+    (void)clock_gettime(CLOCK_MONOTONIC, &next);
+    while (__atomic_load_n(&gs_running, __ATOMIC_ACQUIRE) != 0)
+    {
+        /* sleep to the next absolute deadline */
+        a_sampler_add(&next, gs_period_ns);
+        do
+        {
+            res = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+        } while (res == EINTR);
+        
+        /* wake up latency */
+        (void)clock_gettime(CLOCK_MONOTONIC, &now);
+        latency = a_sampler_diff(&now, &next);
+        if ((gs_stats.samples == 0) || (latency < gs_stats.latency_min_ns))
+        {
+            gs_stats.latency_min_ns = latency;
+        }
+        if (latency > gs_stats.latency_max_ns)
+        {
+            gs_stats.latency_max_ns = latency;
+        }
+        gs_stats.latency_total_ns += latency;
+        
+        /* run the sample */
+        if (gs_sample(gs_arg) != 0)
+        {
+            gs_stats.failures++;
+        }
+        gs_stats.samples++;
+        gs_stats.periods++;
+        
+        /* skip the deadlines that have already passed */
+        (void)clock_gettime(CLOCK_MONOTONIC, &now);
+        while (a_sampler_diff(&now, &next) >= (int64_t)gs_period_ns)
+        {
+            a_sampler_add(&next, gs_period_ns);
+            gs_stats.overruns++;
+            gs_stats.periods++;
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     sampler start
+ * @param[in] *config pointer to a sampler config structure
+ * @param[in] *sample pointer to a sample function
+ * @param[in] *arg pointer to the sample function argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 config is invalid
+ *            - 3 sampler is running
+ *            - 4 cpu affinity failed
+ * @note      the sample function runs once per period on its own thread at absolute deadlines,
+ *            so the period doesn't drift with the sample time, a period the last sample ran past is
+ *            skipped and counted as an overrun, SCHED_FIFO and mlockall fall back quietly without the privilege,
+ *            the cpu is set on the thread attributes so the thread never runs off its cpu
+ */
+uint8_t sampler_start(const sampler_config_t *config, uint8_t (*sample)(void *arg), void *arg)
+{
+    pthread_attr_t attr;
+    struct sched_param param;
+    cpu_set_t set;
+    int res;
+    
+    if ((config == NULL) || (sample == NULL) || (config->rate_hz == 0) || (config->rate_hz > 1000000) ||
+        (config->cpu >= CPU_SETSIZE))
+    {
+        return 2;
+    }
+    if (gs_started != 0)
+    {
+        return 3;
+    }
+    
+    /* init the run */
+    memset(&gs_stats, 0, sizeof(sampler_stats_t));
+    gs_period_ns = 1000000000ULL / config->rate_hz;
+    gs_sample = sample;
+    gs_arg = arg;
+    if (config->lock_memory != 0)
+    {
+        gs_stats.locked = (mlockall(MCL_CURRENT | MCL_FUTURE) == 0) ? 1 : 0;
+    }
+    __atomic_store_n(&gs_running, 1, __ATOMIC_RELEASE);
+    
+    /* pin the thread before it runs */
+    (void)pthread_attr_init(&attr);
+    if (config->cpu >= 0)
+    {
+        CPU_ZERO(&set);
+        CPU_SET(config->cpu, &set);
+        if (pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &set) != 0)
+        {
+            (void)pthread_attr_destroy(&attr);
+            __atomic_store_n(&gs_running, 0, __ATOMIC_RELEASE);
+            if (gs_stats.locked != 0)
+            {
+                (void)munlockall();
+            }
+            
+            return 4;
+        }
+    }
+    
+    /* start with SCHED_FIFO and fall back to the normal scheduler */
+    res = -1;
+    if (config->priority > 0)
+    {
+        (void)pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        (void)pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = config->priority;
+        (void)pthread_attr_setschedparam(&attr, &param);
+        res = pthread_create(&gs_thread, &attr, a_sampler_thread, NULL);
+        gs_stats.realtime = (res == 0) ? 1 : 0;
+    }
+    if (res != 0)
+    {
+        (void)pthread_attr_setinheritsched(&attr, PTHREAD_INHERIT_SCHED);
+        res = pthread_create(&gs_thread, &attr, a_sampler_thread, NULL);
+    }
+    (void)pthread_attr_destroy(&attr);
+    if (res != 0)
+    {
+        __atomic_store_n(&gs_running, 0, __ATOMIC_RELEASE);
+        if (gs_stats.locked != 0)
+        {
+            (void)munlockall();
+        }
+        
+        /* the cpu is checked when the thread is created */
+        return ((config->cpu >= 0) && (res == EINVAL)) ? 4 : 1;
+    }
+    gs_started = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief      sampler stop
+ * @param[out] *stats pointer to a sampler stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 stop failed
+ * @note       waits for the sampler thread and returns the stats of the whole run
+ */
+uint8_t sampler_stop(sampler_stats_t *stats)
+{
+    if (gs_started == 0)
+    {
+        return 1;
+    }
+    
+    /* wait for the thread */
+    __atomic_store_n(&gs_running, 0, __ATOMIC_RELEASE);
+    if (pthread_join(gs_thread, NULL) != 0)
+    {
+        return 1;
+    }
+    gs_started = 0;
+    if (gs_stats.locked != 0)
+    {
+        (void)munlockall();
+    }
+    if (stats != NULL)
+    {
+        *stats = gs_stats;
+    }
+    
+    return 0;
+}
@@ -36,9 +36,54 @@
 
 #include "driver_as5600_register_test.h"
 #include "driver_as5600_read_test.h"
+#include "driver_as5600_burst_test.h"
+#include "driver_as5600_sim_test.h"
 #include "driver_as5600_basic.h"
 #include <getopt.h>
 #include <stdlib.h>
+#include "sampler.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <unistd.h>
+
+/**
+ * @brief stream ring size definition
+ */
+#define STREAM_RING_SIZE 4096        /**< samples the stream ring holds while the output catches up */
+#define STREAM_BATCH     64          /**< binary frames written at once */
+
+/**
+ * @brief stream variable definition
+ */
+static as5600_sample_t gs_ring_buf[STREAM_RING_SIZE];        /**< stream ring buffer */
+static as5600_ring_t gs_ring;                                /**< stream ring */
+
+/**
+ * @brief     stream sample function
+ * @param[in] *arg pointer to an as5600 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sample failed
+ * @note      runs on the sampler thread
+ */
+static uint8_t a_stream_sample(void *arg)
+{
+    return as5600_basic_sample((as5600_ring_t *)arg);
+}
+
+/**
+ * @brief     stream print format data to the stderr
+ * @param[in] fmt format data
+ * @note      keeps the stdout free for the binary frames
+ */
+static void a_stream_error_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
 
 /**
  * @brief     as5600 full function
@@ -63,10 +108,18 @@ uint8_t as5600(uint8_t argc, char **argv)
         {"example", required_argument, NULL, 'e'},
         {"test", required_argument, NULL, 't'},
         {"times", required_argument, NULL, 1},
+        {"rate", required_argument, NULL, 2},
+        {"priority", required_argument, NULL, 3},
+        {"cpu", required_argument, NULL, 4},
+        {"format", required_argument, NULL, 5},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     uint32_t times = 3;
+    uint32_t rate = 1000;
+    int priority = 0;
+    int cpu = -1;
+    uint8_t binary = 0;
     
     /* if no params */
     if (argc == 1)
@@ -146,6 +199,53 @@ uint8_t as5600(uint8_t argc, char **argv)
                 break;
             } 
             
+            /* sample rate */
+            case 2 :
+            {
+                /* set the rate */
+                rate = atol(optarg);
+                
+                break;
+            } 
+            
+            /* real time priority */
+            case 3 :
+            {
+                /* set the priority */
+                priority = atoi(optarg);
+                
+                break;
+            } 
+            
+            /* cpu affinity */
+            case 4 :
+            {
+                /* set the cpu */
+                cpu = atoi(optarg);
+                
+                break;
+            } 
+            
+            /* stream format */
+            case 5 :
+            {
+                /* set the format */
+                if (strcmp("binary", optarg) == 0)
+                {
+                    binary = 1;
+                }
+                else if (strcmp("text", optarg) == 0)
+                {
+                    binary = 0;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            } 
+            
             /* the end */
             case -1 :
             {
@@ -185,6 +285,30 @@ uint8_t as5600(uint8_t argc, char **argv)
             return 0;
         }
     }
+    else if (strcmp("t_burst", type) == 0)
+    {
+        /* run burst test */
+        if (as5600_burst_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_sim", type) == 0)
+    {
+        /* run sim test */
+        if (as5600_sim_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
     else if (strcmp("e_read", type) == 0)
     {
         uint8_t res;
@@ -200,10 +324,17 @@ uint8_t as5600(uint8_t argc, char **argv)
         /* loop */
         for (i = 0; i < times; i++)
         {
+#if (AS5600_FLOAT_ENABLE == 1)
             float deg;
             
             /* read data */
             res = as5600_basic_read(&deg);
+#else
+            int32_t deg_q16;
+            
+            /* read data */
+            res = as5600_basic_read_fixed(AS5600_FIXED_FORMAT_DEG_Q16, &deg_q16);
+#endif
             if (res != 0)
             {
                 (void)as5600_basic_deinit();
@@ -215,7 +346,11 @@ uint8_t as5600(uint8_t argc, char **argv)
             as5600_interface_debug_print("as5600: %d/%d.\n", i + 1, times);
             
             /* output */
+#if (AS5600_FLOAT_ENABLE == 1)
             as5600_interface_debug_print("as5600: angle is %.2f.\n", deg);
+#else
+            as5600_interface_debug_print("as5600: angle is %d.%02d.\n", (int)(deg_q16 >> 16), (int)(((deg_q16 & 0xFFFF) * 100) >> 16));
+#endif
             
             /* delay 1000ms */
             as5600_interface_delay_ms(1000);
@@ -226,6 +361,115 @@ uint8_t as5600(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_stream", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        uint32_t idle;
+        uint32_t count;
+        uint32_t dropped;
+        uint32_t n;
+        as5600_sample_t sample;
+        sampler_config_t config;
+        sampler_stats_t stats;
+        uint8_t frames[STREAM_BATCH * AS5600_STREAM_FRAME_SIZE];
+        void (*print)(const char *const fmt, ...);
+        
+        /* the binary frames own the stdout */
+        print = (binary != 0) ? a_stream_error_print : as5600_interface_debug_print;
+        
+        /* basic init */
+        res = as5600_basic_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* start the sampler, it fills the ring at the rate on its own thread */
+        (void)as5600_ring_init(&gs_ring, gs_ring_buf, STREAM_RING_SIZE);
+        config.rate_hz = rate;
+        config.priority = priority;
+        config.cpu = cpu;
+        config.lock_memory = (priority > 0) ? 1 : 0;
+        res = sampler_start(&config, a_stream_sample, &gs_ring);
+        if (res == 4)
+        {
+            print("as5600: sampler cpu %d affinity failed.\n", cpu);
+            (void)as5600_basic_deinit();
+            
+            return 1;
+        }
+        if (res != 0)
+        {
+            print("as5600: sampler start failed.\n");
+            (void)as5600_basic_deinit();
+            
+            return 1;
+        }
+        
+        /* drain the ring, the output never blocks the sampler */
+        i = 0;
+        idle = 0;
+        while ((i < times) && (idle < 1000))
+        {
+            n = 0;
+            while ((i < times) && (n < STREAM_BATCH) && (as5600_ring_pop(&gs_ring, &sample) == 0))
+            {
+                if (binary != 0)
+                {
+                    /* the producer sequence skips over the dropped samples and lets the decoder count them */
+                    (void)as5600_stream_encode(&sample, sample.sequence, &frames[n * AS5600_STREAM_FRAME_SIZE]);
+                }
+                else
+                {
+                    as5600_interface_debug_print("as5600: %u us raw angle is %d and status is 0x%02X.\n",
+                                                 (unsigned int)sample.timestamp_us, sample.raw_angle, sample.status);
+                }
+                i++;
+                n++;
+            }
+            if (n != 0)
+            {
+                idle = 0;
+                if (binary != 0)
+                {
+                    (void)fwrite(frames, AS5600_STREAM_FRAME_SIZE, n, stdout);
+                    (void)fflush(stdout);
+                }
+            }
+            else
+            {
+                /* wait 1ms for the sampler */
+                idle++;
+                usleep(1000);
+            }
+        }
+        
+        /* stop the sampler */
+        (void)sampler_stop(&stats);
+        (void)as5600_ring_get_count(&gs_ring, &count, &dropped);
+        (void)as5600_basic_deinit();
+        
+        /* output the stats */
+        print("as5600: %llu samples in %llu periods at %u hz.\n",
+              (unsigned long long)stats.samples, (unsigned long long)stats.periods, (unsigned int)rate);
+        print("as5600: %llu overruns, %llu failures and %u dropped samples.\n",
+              (unsigned long long)stats.overruns, (unsigned long long)stats.failures, (unsigned int)dropped);
+        if (stats.samples != 0)
+        {
+            print("as5600: wake up latency min is %lld ns, max is %lld ns and mean is %lld ns.\n",
+                  (long long)stats.latency_min_ns, (long long)stats.latency_max_ns,
+                  (long long)(stats.latency_total_ns / (int64_t)stats.samples));
+        }
+        print("as5600: SCHED_FIFO is %s and memory lock is %s.\n",
+              (stats.realtime != 0) ? "on" : "off", (stats.locked != 0) ? "on" : "off");
+        if ((i < times) || (stats.failures != 0))
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -235,15 +479,25 @@ uint8_t as5600(uint8_t argc, char **argv)
         as5600_interface_debug_print("  as5600 (-p | --port)\n");
         as5600_interface_debug_print("  as5600 (-t reg | --test=reg)\n");
         as5600_interface_debug_print("  as5600 (-t read | --test=read) [--times=<num>]\n");
+        as5600_interface_debug_print("  as5600 (-t burst | --test=burst) [--times=<num>]\n");
+        as5600_interface_debug_print("  as5600 (-t sim | --test=sim) [--times=<num>]\n");
         as5600_interface_debug_print("  as5600 (-e read | --example=read) [--times=<num>]\n");
+        as5600_interface_debug_print("  as5600 (-e stream | --example=stream) [--times=<num>] [--rate=<hz>] [--priority=<num>] [--cpu=<num>]\n");
+        as5600_interface_debug_print("         [--format=<text | binary>]\n");
         as5600_interface_debug_print("\n");
         as5600_interface_debug_print("Options:\n");
-        as5600_interface_debug_print("  -e <read>, --example=<read>             Run the driver example.\n");
+        as5600_interface_debug_print("  -e <read | stream>, --example=<read | stream>\n");
+        as5600_interface_debug_print("                                          Run the driver example.\n");
         as5600_interface_debug_print("  -h, --help                              Show the help.\n");
         as5600_interface_debug_print("  -i, --information                       Show the chip information.\n");
         as5600_interface_debug_print("  -p, --port                              Display the pin connections of the current board.\n");
-        as5600_interface_debug_print("  -t <reg | read>, --test=<reg | read>    Run the driver test.\n");
+        as5600_interface_debug_print("  -t <reg | read | burst | sim>, --test=<reg | read | burst | sim>\n");
+        as5600_interface_debug_print("                                          Run the driver test.\n");
         as5600_interface_debug_print("      --times=<num>                       Set the running times.([default: 3])\n");
+        as5600_interface_debug_print("      --rate=<hz>                         Set the stream sample rate.([default: 1000])\n");
+        as5600_interface_debug_print("      --priority=<num>                    Set the stream SCHED_FIFO priority and lock the memory.([default: 0])\n");
+        as5600_interface_debug_print("      --cpu=<num>                         Set the stream sampler cpu.([default: any])\n");
+        as5600_interface_debug_print("      --format=<text | binary>            Set the stream output, binary writes the stream frames to the stdout.([default: text])\n");
         
         return 0;
     }
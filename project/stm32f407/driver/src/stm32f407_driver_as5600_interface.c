@@ -96,6 +96,204 @@ uint8_t as5600_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint
     return iic_write(addr, reg, buf, len);
 }
 
+/**
+ * @brief      interface iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return iic_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief     interface iic bus init with the user data
+ * @param[in] *user_data unused, the port drives one software iic bus
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
+ */
+uint8_t as5600_interface_iic_init_ex(void *user_data)
+{
+    (void)user_data;
+    
+    return as5600_interface_iic_init();
+}
+
+/**
+ * @brief     interface iic bus deinit with the user data
+ * @param[in] *user_data unused, the port drives one software iic bus
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t as5600_interface_iic_deinit_ex(void *user_data)
+{
+    (void)user_data;
+    
+    return as5600_interface_iic_deinit();
+}
+
+/**
+ * @brief      interface iic bus read with the user data
+ * @param[in]  *user_data unused, the port drives one software iic bus
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read_ex(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)user_data;
+    
+    return as5600_interface_iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface iic bus write with the user data
+ * @param[in] *user_data unused, the port drives one software iic bus
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t as5600_interface_iic_write_ex(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)user_data;
+    
+    return as5600_interface_iic_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command with the user data
+ * @param[in]  *user_data unused, the port drives one software iic bus
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_interface_iic_read_cmd_ex(void *user_data, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)user_data;
+    
+    return as5600_interface_iic_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus repeated read
+ * @param[in]  *user_data unused, the port drives one software iic bus
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of one read
+ * @param[in]  num read times
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the register address is written once and then num reads of len bytes follow,
+ *             the buffer size must be len * num
+ */
+uint8_t as5600_interface_iic_read_repeat(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    uint16_t i;
+    
+    (void)user_data;
+    
+    /* set the pointer and read the first one */
+    if (num == 0)
+    {
+        return 0;
+    }
+    if (iic_read(addr, reg, buf, len) != 0)
+    {
+        return 1;
+    }
+    
+    /* read the rest without the register address */
+    for (i = 1; i < num; i++)
+    {
+        if (iic_read_cmd(addr, buf + (uint32_t)i * len, len) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus async read
+ * @param[in]  *user_data unused, the port drives one software iic bus
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *done pointer to a completion function
+ * @param[in]  *ctx pointer to the completion context
+ * @return     status code
+ *             - 0 success
+ *             - 1 read start failed
+ * @note       the software iic has no completion interrupt, so this falls back to a blocking read
+ *             and done is called before it returns, a dma or interrupt driven hal read calls done from its callback
+ */
+uint8_t as5600_interface_iic_read_async(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                        void (*done)(void *ctx, uint8_t res), void *ctx)
+{
+    (void)user_data;
+    
+    done(ctx, iic_read(addr, reg, buf, len));
+    
+    return 0;
+}
+
+/**
+ * @brief  interface timestamp us
+ * @return free running time in us
+ * @note   the hal tick and the systick counter are combined, the value wraps after about 71 minutes
+ */
+uint32_t as5600_interface_timestamp_us(void)
+{
+    uint32_t ms;
+    uint32_t val;
+    
+    /* read the tick and the counter without a tick between them */
+    do
+    {
+        ms = HAL_GetTick();
+        val = SysTick->VAL;
+    } while (ms != HAL_GetTick());
+    
+    return ms * 1000 + (SysTick->LOAD + 1 - val) / (SystemCoreClock / 1000000);
+}
+
+/**
+ * @brief     interface delay us
+ * @param[in] us time
+ * @note      none
+ */
+void as5600_interface_delay_us(uint32_t us)
+{
+    delay_us(us);
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
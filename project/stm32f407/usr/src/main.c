@@ -36,6 +36,8 @@
 
 #include "driver_as5600_register_test.h"
 #include "driver_as5600_read_test.h"
+#include "driver_as5600_burst_test.h"
+#include "driver_as5600_sim_test.h"
 #include "driver_as5600_basic.h"
 #include "shell.h"
 #include "clock.h"
@@ -50,6 +52,18 @@
 uint8_t g_buf[256];        /**< uart buffer */
 volatile uint16_t g_len;   /**< uart buffer length */
 
+/**
+ * @brief stream definition
+ */
+#define STREAM_RING_SIZE 64        /**< stream ring size */
+#define STREAM_BATCH     8         /**< frames written to the uart at once */
+
+/**
+ * @brief stream var definition
+ */
+static as5600_sample_t gs_ring_buf[STREAM_RING_SIZE];        /**< stream ring buffer */
+static as5600_ring_t gs_ring;                                /**< stream ring */
+
 /**
  * @brief     as5600 full function
  * @param[in] argc arg numbers
@@ -73,10 +87,12 @@ uint8_t as5600(uint8_t argc, char **argv)
         {"example", required_argument, NULL, 'e'},
         {"test", required_argument, NULL, 't'},
         {"times", required_argument, NULL, 1},
+        {"rate", required_argument, NULL, 2},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     uint32_t times = 3;
+    uint32_t rate = 100;
 
     /* if no params */
     if (argc == 1)
@@ -156,6 +172,15 @@ uint8_t as5600(uint8_t argc, char **argv)
                 break;
             }
 
+            /* sample rate */
+            case 2 :
+            {
+                /* set the rate */
+                rate = atol(optarg);
+
+                break;
+            }
+
             /* the end */
             case -1 :
             {
@@ -195,6 +220,30 @@ uint8_t as5600(uint8_t argc, char **argv)
             return 0;
         }
     }
+    else if (strcmp("t_burst", type) == 0)
+    {
+        /* run burst test */
+        if (as5600_burst_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_sim", type) == 0)
+    {
+        /* run sim test */
+        if (as5600_sim_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
     else if (strcmp("e_read", type) == 0)
     {
         uint8_t res;
@@ -210,10 +259,17 @@ uint8_t as5600(uint8_t argc, char **argv)
         /* loop */
         for (i = 0; i < times; i++)
         {
+#if (AS5600_FLOAT_ENABLE == 1)
             float deg;
 
             /* read data */
             res = as5600_basic_read(&deg);
+#else
+            int32_t deg_q16;
+
+            /* read data */
+            res = as5600_basic_read_fixed(AS5600_FIXED_FORMAT_DEG_Q16, &deg_q16);
+#endif
             if (res != 0)
             {
                 (void)as5600_basic_deinit();
@@ -225,7 +281,11 @@ uint8_t as5600(uint8_t argc, char **argv)
             as5600_interface_debug_print("as5600: %d/%d.\n", i + 1, times);
 
             /* output */
+#if (AS5600_FLOAT_ENABLE == 1)
             as5600_interface_debug_print("as5600: angle is %.2f.\n", deg);
+#else
+            as5600_interface_debug_print("as5600: angle is %d.%02d.\n", (int)(deg_q16 >> 16), (int)(((deg_q16 & 0xFFFF) * 100) >> 16));
+#endif
 
             /* delay 1000ms */
             as5600_interface_delay_ms(1000);
@@ -236,6 +296,71 @@ uint8_t as5600(uint8_t argc, char **argv)
 
         return 0;
     }
+    else if (strcmp("e_stream", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        uint32_t n;
+        uint32_t period;
+        uint32_t next;
+        uint32_t now;
+        as5600_sample_t sample;
+        uint8_t frames[STREAM_BATCH * AS5600_STREAM_FRAME_SIZE];
+
+        /* check the rate */
+        if ((rate == 0) || (rate > 100000))
+        {
+            return 5;
+        }
+
+        /* basic init */
+        res = as5600_basic_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+
+        /* sample at absolute deadlines so the period doesn't drift with the uart */
+        (void)as5600_ring_init(&gs_ring, gs_ring_buf, STREAM_RING_SIZE);
+        period = 1000000 / rate;
+        next = as5600_interface_timestamp_us();
+        n = 0;
+        for (i = 0; i < times; i++)
+        {
+            /* wait for the deadline */
+            next += period;
+            do
+            {
+                now = as5600_interface_timestamp_us();
+            } while ((int32_t)(now - next) < 0);
+
+            /* sample */
+            res = as5600_basic_sample(&gs_ring);
+            if (res != 0)
+            {
+                (void)as5600_basic_deinit();
+
+                return 1;
+            }
+
+            /* encode the queued samples with their producer sequence and write a batch */
+            while (as5600_ring_pop(&gs_ring, &sample) == 0)
+            {
+                (void)as5600_stream_encode(&sample, sample.sequence, &frames[n * AS5600_STREAM_FRAME_SIZE]);
+                n++;
+            }
+            if ((n == STREAM_BATCH) || ((i + 1) == times))
+            {
+                (void)uart_write(frames, (uint16_t)(n * AS5600_STREAM_FRAME_SIZE));
+                n = 0;
+            }
+        }
+
+        /* deinit */
+        (void)as5600_basic_deinit();
+
+        return 0;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -245,15 +370,21 @@ uint8_t as5600(uint8_t argc, char **argv)
         as5600_interface_debug_print("  as5600 (-p | --port)\n");
         as5600_interface_debug_print("  as5600 (-t reg | --test=reg)\n");
         as5600_interface_debug_print("  as5600 (-t read | --test=read) [--times=<num>]\n");
+        as5600_interface_debug_print("  as5600 (-t burst | --test=burst) [--times=<num>]\n");
+        as5600_interface_debug_print("  as5600 (-t sim | --test=sim) [--times=<num>]\n");
         as5600_interface_debug_print("  as5600 (-e read | --example=read) [--times=<num>]\n");
+        as5600_interface_debug_print("  as5600 (-e stream | --example=stream) [--times=<num>] [--rate=<hz>]\n");
         as5600_interface_debug_print("\n");
         as5600_interface_debug_print("Options:\n");
-        as5600_interface_debug_print("  -e <read>, --example=<read>             Run the driver example.\n");
+        as5600_interface_debug_print("  -e <read | stream>, --example=<read | stream>\n");
+        as5600_interface_debug_print("                                          Run the driver example.\n");
         as5600_interface_debug_print("  -h, --help                              Show the help.\n");
         as5600_interface_debug_print("  -i, --information                       Show the chip information.\n");
         as5600_interface_debug_print("  -p, --port                              Display the pin connections of the current board.\n");
-        as5600_interface_debug_print("  -t <reg | read>, --test=<reg | read>    Run the driver test.\n");
+        as5600_interface_debug_print("  -t <reg | read | burst | sim>, --test=<reg | read | burst | sim>\n");
+        as5600_interface_debug_print("                                          Run the driver test.\n");
         as5600_interface_debug_print("      --times=<num>                       Set the running times.([default: 3])\n");
+        as5600_interface_debug_print("      --rate=<hz>                         Set the stream sample rate, the frames are written to the uart.([default: 100])\n");
 
         return 0;
     }
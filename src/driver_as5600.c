@@ -75,1209 +75,3984 @@
 #define AS5600_REG_MAGNITUDE_L        0x1C        /**< magnitude register low */
 #define AS5600_REG_BURN               0xFF        /**< burn register */
 
+/**
+ * @brief field flag definition
+ */
+#define AS5600_FIELD_FLAG_WRITE        (1 << 0)        /**< field is writable */
+#define AS5600_FIELD_FLAG_WORD         (1 << 1)        /**< field owns the register word, reserved bits are written as 0 */
+
+/**
+ * @brief field descriptor structure definition
+ */
+typedef struct as5600_field_desc_s
+{
+    uint8_t reg;          /**< first register */
+    uint8_t shift;        /**< bit shift in the register word */
+    uint8_t width;        /**< bit width */
+    uint8_t flag;         /**< field flag */
+} as5600_field_desc_t;
+
+/**
+ * @brief field descriptor table, indexed by as5600_field_t
+ * @note  a field wider than one register is a big endian word starting at reg
+ */
+static const as5600_field_desc_t gs_field_table[AS5600_FIELD_NUM] =
+{
+    {AS5600_REG_ZPOS_H,      0, 12, AS5600_FIELD_FLAG_WRITE | AS5600_FIELD_FLAG_WORD},        /* start position */
+    {AS5600_REG_MPOS_H,      0, 12, AS5600_FIELD_FLAG_WRITE | AS5600_FIELD_FLAG_WORD},        /* stop position */
+    {AS5600_REG_MANG_H,      0, 12, AS5600_FIELD_FLAG_WRITE | AS5600_FIELD_FLAG_WORD},        /* max angle */
+    {AS5600_REG_CONF_H,      5, 1,  AS5600_FIELD_FLAG_WRITE},                                 /* watch dog */
+    {AS5600_REG_CONF_H,      2, 3,  AS5600_FIELD_FLAG_WRITE},                                 /* fast filter threshold */
+    {AS5600_REG_CONF_H,      0, 2,  AS5600_FIELD_FLAG_WRITE},                                 /* slow filter */
+    {AS5600_REG_CONF_L,      6, 2,  AS5600_FIELD_FLAG_WRITE},                                 /* pwm frequency */
+    {AS5600_REG_CONF_L,      4, 2,  AS5600_FIELD_FLAG_WRITE},                                 /* output stage */
+    {AS5600_REG_CONF_L,      2, 2,  AS5600_FIELD_FLAG_WRITE},                                 /* hysteresis */
+    {AS5600_REG_CONF_L,      0, 2,  AS5600_FIELD_FLAG_WRITE},                                 /* power mode */
+    {AS5600_REG_STATUS,      0, 8,  0},                                                       /* status */
+    {AS5600_REG_RAW_ANGLE_H, 0, 12, 0},                                                       /* raw angle */
+    {AS5600_REG_ANGLE_H,     0, 12, 0},                                                       /* angle */
+    {AS5600_REG_AGC,         0, 8,  0},                                                       /* agc */
+    {AS5600_REG_MAGNITUDE_H, 0, 12, 0},                                                       /* magnitude */
+};
+
+/**
+ * @brief stats hook definition
+ * @note  select starts a call of an api and end counts one transaction of the call,
+ *        the hooks expand to nothing when AS5600_STATS_ENABLE is 0
+ */
+#if (AS5600_STATS_ENABLE == 1)
+    #define AS5600_STATS_SELECT(handle, api)        a_as5600_stats_select(handle, (uint8_t)(api))
+    #define AS5600_STATS_END(handle, len, res)      a_as5600_stats_end(handle, len, res)
+#else
+    #define AS5600_STATS_SELECT(handle, api)
+    #define AS5600_STATS_END(handle, len, res)
+#endif
+
+/**
+ * @brief     take the transaction start time
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @note      none
+ */
+static void a_as5600_xfer_begin(as5600_handle_t *handle)
+{
+    if (handle->timestamp_us != NULL)                    /* if the timestamp is linked */
+    {
+        handle->xfer_start = handle->timestamp_us();     /* save the start time */
+    }
+}
+
+/**
+ * @brief     take the transaction end time
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @note      none
+ */
+static void a_as5600_xfer_end(as5600_handle_t *handle)
+{
+    if (handle->timestamp_us != NULL)                  /* if the timestamp is linked */
+    {
+        handle->xfer_end = handle->timestamp_us();     /* save the end time */
+    }
+}
+
+/**
+ * @brief     stamp the last sample of the last transaction
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] n evenly spaced samples in the transaction
+ * @note      one sample is stamped at the transaction midpoint,
+ *            the last of n samples at the midpoint of the last n-th of the transaction
+ */
+static void a_as5600_sample_stamp(as5600_handle_t *handle, uint32_t n)
+{
+    uint32_t span;
+
+    span = handle->xfer_end - handle->xfer_start;                            /* get the span, wrap safe */
+    handle->sample_timestamp = handle->xfer_start + span - span / (2 * n);   /* set the sample timestamp */
+}
+
+#if (AS5600_STATS_ENABLE == 1)
+/**
+ * @brief     count the latency of the current call
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @note      the call is timed from the start of its first transaction to the end of its last transaction,
+ *            a call without a timed transaction is not counted
+ */
+static void a_as5600_stats_commit(as5600_handle_t *handle)
+{
+    uint32_t us;
+    uint32_t bucket;
+    as5600_stats_latency_t *latency;
+
+    if (handle->stats_call == 0)                                                   /* check the call */
+    {
+        return;                                                                    /* nothing to count */
+    }
+    us = handle->stats_call_end - handle->stats_call_start;                        /* get the latency, wrap safe */
+    latency = &handle->stats.latency[handle->stats_api];                           /* get the api latency */
+    if ((latency->count == 0) || (us < latency->min_us))                           /* check the min */
+    {
+        latency->min_us = us;                                                      /* set the min */
+    }
+    if (us > latency->max_us)                                                      /* check the max */
+    {
+        latency->max_us = us;                                                      /* set the max */
+    }
+    latency->total_us += us;                                                       /* add to the total */
+    latency->count++;                                                              /* count the timed call */
+    bucket = 0;                                                                    /* init 0 */
+    while ((us != 0) && (bucket < (AS5600_STATS_HISTOGRAM_NUM - 1)))               /* find the log2 bucket */
+    {
+        us >>= 1;                                                                  /* next power of 2 */
+        bucket++;                                                                  /* next bucket */
+    }
+    handle->stats.histogram[bucket]++;                                             /* count to the bucket */
+    handle->stats_call = 0;                                                        /* close the call */
+}
+
+/**
+ * @brief     start a stats call
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] api stats api of the call
+ * @note      the previous call is counted first
+ */
+static void a_as5600_stats_select(as5600_handle_t *handle, uint8_t api)
+{
+    a_as5600_stats_commit(handle);                                                 /* count the previous call */
+    handle->stats_api = api;                                                       /* set the api */
+}
+
+/**
+ * @brief     finish a stats transaction
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] len payload length
+ * @param[in] res transaction result
+ * @note      the transaction is counted at once and its times extend the current call
+ */
+static void a_as5600_stats_end(as5600_handle_t *handle, uint32_t len, uint8_t res)
+{
+    handle->stats.transactions++;                                                  /* count the transaction */
+    handle->stats.bytes += len;                                                    /* count the payload */
+    if (res != 0)                                                                  /* check the result */
+    {
+        handle->stats.failures++;                                                  /* count the failure */
+    }
+    if (handle->timestamp_us != NULL)                                              /* if the timestamp is linked */
+    {
+        if (handle->stats_call == 0)                                               /* if the first transaction */
+        {
+            handle->stats_call_start = handle->xfer_start;                         /* set the call start */
+            handle->stats_call = 1;                                                /* open the call */
+        }
+        handle->stats_call_end = handle->xfer_end;                                 /* set the call end */
+    }
+}
+#endif
+
+/**
+ * @brief     get the crc8 of a stream frame
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    crc8 with the polynomial 0x07 and the init 0x00
+ * @note      none
+ */
+static uint8_t a_as5600_stream_crc8(const uint8_t *buf, uint8_t len)
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t crc;
+
+    crc = 0x00;                                                                  /* init 0x00 */
+    for (i = 0; i < len; i++)                                                    /* run all bytes */
+    {
+        crc ^= buf[i];                                                           /* xor the byte */
+        for (j = 0; j < 8; j++)                                                  /* run all bits */
+        {
+            crc = (uint8_t)((crc & 0x80) ? ((crc << 1) ^ 0x07) : (crc << 1));    /* shift with the polynomial */
+        }
+    }
+
+    return crc;                                                                  /* return the crc */
+}
+
+/**
+ * @brief     finish an async transfer
+ * @param[in] *ctx pointer to an as5600 handle structure
+ * @param[in] res transfer result
+ * @note      runs in the bus completion context
+ */
+static void a_as5600_async_done(void *ctx, uint8_t res)
+{
+    as5600_handle_t *handle = (as5600_handle_t *)ctx;
+    uint8_t state;
+
+    a_as5600_xfer_end(handle);                                                    /* take the end time */
+    AS5600_STATS_END(handle, 2, res);                                             /* stats end */
+#if (AS5600_STATS_ENABLE == 1)
+    a_as5600_stats_commit(handle);                                                /* the async call ends here */
+#endif
+    state = (res != 0) ? AS5600_ASYNC_STATE_FAILED : AS5600_ASYNC_STATE_DONE;     /* get the state */
+    AS5600_STORE_RELEASE(&handle->async_state, state);                            /* publish the state after the data */
+    if (handle->receive_callback != NULL)                                         /* if the callback is linked */
+    {
+        handle->receive_callback(state);                                          /* run the callback */
+    }
+}
+
+/**
+ * @brief     update the shadow cache
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] reg iic register address
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @note      only the bytes inside the zpos to conf range are updated
+ */
+static void a_as5600_shadow_update(as5600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint16_t i;
+    uint16_t addr;
+
+    if (handle->shadow_valid != 1)                                          /* check the shadow valid */
+    {
+        return;                                                             /* nothing to update */
+    }
+    for (i = 0; i < len; i++)                                               /* check all */
+    {
+        addr = (uint16_t)reg + i;                                           /* get the address */
+        if ((addr >= AS5600_REG_ZPOS_H) && (addr <= AS5600_REG_CONF_L))     /* check the range */
+        {
+            handle->shadow[addr - AS5600_REG_ZPOS_H] = data[i];             /* save to the shadow */
+        }
+    }
+}
+
 /**
  * @brief      read bytes
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[in]  reg iic register address
- * @param[out] *data pointer to a data buffer
- * @param[in]  len data length
+ * @param[in]  reg iic register address
+ * @param[out] *data pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_as5600_iic_read(as5600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint8_t res;
+
+    handle->poll_ready = 0;                                            /* address pointer is moved */
+    a_as5600_xfer_begin(handle);                                       /* take the start time */
+    if (handle->iic_read_ex != NULL)                                   /* if the user data read is linked */
+    {
+        res = handle->iic_read_ex(handle->user_data, AS5600_ADDRESS,
+                                  reg, data, len);                     /* read the register */
+    }
+    else
+    {
+        res = handle->iic_read(AS5600_ADDRESS, reg, data, len);        /* read the register */
+    }
+    a_as5600_xfer_end(handle);                                         /* take the end time */
+    AS5600_STATS_END(handle, len, res);                                /* stats end */
+    if (res != 0)                                                      /* check the result */
+    {
+        return 1;                                                      /* return error */
+    }
+    else
+    {
+        a_as5600_shadow_update(handle, reg, data, len);                /* update the shadow cache */
+
+        return 0;                                                      /* success return 0 */
+    }
+}
+
+/**
+ * @brief     write bytes
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] reg iic register address
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_as5600_iic_write(as5600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint8_t res;
+
+    handle->poll_ready = 0;                                                                   /* address pointer is moved */
+    a_as5600_xfer_begin(handle);                                                              /* take the start time */
+    if (handle->iic_write_ex != NULL)                                                         /* if the user data write is linked */
+    {
+        res = handle->iic_write_ex(handle->user_data, AS5600_ADDRESS,
+                                   reg, data, len);                                           /* write the register */
+    }
+    else
+    {
+        res = handle->iic_write(AS5600_ADDRESS, reg, data, len);                              /* write the register */
+    }
+    a_as5600_xfer_end(handle);                                                                /* take the end time */
+    AS5600_STATS_END(handle, len, res);                                                       /* stats end */
+    if (res != 0)                                                                             /* check the result */
+    {
+        return 1;                                                                             /* return error */
+    }
+    else
+    {
+        a_as5600_shadow_update(handle, reg, data, len);                                       /* write through the shadow cache */
+        if ((reg <= AS5600_REG_MANG_L) && (((uint16_t)reg + len) > AS5600_REG_ZPOS_H))        /* if the range is written */
+        {
+            handle->range_valid = 0;                                                          /* drop the range cache */
+        }
+
+        return 0;                                                                             /* success return 0 */
+    }
+}
+
+/**
+ * @brief     check a read for the tear free verification
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] reg iic register address
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @param[in] jump bool value, check the raw angle jump or not
+ * @return    status code
+ *            - 0 plausible
+ *            - 1 reserved bits are set
+ *            - 2 raw angle jump is over the max step
+ * @note      the last raw angle is only updated by a plausible read
+ */
+static uint8_t a_as5600_verify_check(as5600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len, as5600_bool_t jump)
+{
+    uint16_t i;
+    uint16_t addr;
+    uint16_t raw;
+    int16_t step;
+
+    for (i = 0; (i + 1) < len; i++)                                               /* check all words */
+    {
+        addr = (uint16_t)reg + i;                                                 /* get the address */
+        if (((addr == AS5600_REG_RAW_ANGLE_H) || (addr == AS5600_REG_ANGLE_H) ||
+             (addr == AS5600_REG_MAGNITUDE_H)) && ((data[i] & 0xF0) != 0))        /* check the reserved bits */
+        {
+            return 1;                                                             /* reserved bits are set */
+        }
+    }
+    if ((reg > AS5600_REG_RAW_ANGLE_H) ||
+        (((uint16_t)reg + len) <= AS5600_REG_RAW_ANGLE_L))                        /* if no raw angle */
+    {
+        return 0;                                                                 /* plausible */
+    }
+    i = (uint16_t)(AS5600_REG_RAW_ANGLE_H - reg);                                 /* get the raw angle index */
+    raw = (uint16_t)(((data[i] & 0xF) << 8) | data[i + 1]);                       /* get the raw angle */
+    if ((jump == AS5600_BOOL_TRUE) && (handle->verify_valid == 1))                /* if check the jump */
+    {
+        step = (int16_t)((raw - handle->verify_last) & 0xFFF);                    /* get the step */
+        if (step >= 2048)                                                         /* take the shortest path */
+        {
+            step = (int16_t)(step - 4096);                                        /* backward */
+        }
+        if ((step > (int16_t)handle->verify_max_step) ||
+            (step < -(int16_t)handle->verify_max_step))                           /* check the step */
+        {
+            return 2;                                                             /* raw angle jump */
+        }
+    }
+    handle->verify_last = raw;                                                    /* save the last sample */
+    handle->verify_valid = 1;                                                     /* set valid */
+
+    return 0;                                                                     /* plausible */
+}
+
+/**
+ * @brief         verify a read sample
+ * @param[in]     *handle pointer to an as5600 handle structure
+ * @param[in]     reg iic register address
+ * @param[in,out] *data pointer to a data buffer
+ * @param[in]     len data length
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          a suspicious sample is read again once in the same stats call,
+ *                the repeat is taken as it is unless its reserved bits are set again
+ */
+static uint8_t a_as5600_verify_sample(as5600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint8_t res;
+
+    if (handle->verify_enable != 1)                                                   /* check the verify */
+    {
+        return 0;                                                                     /* success return 0 */
+    }
+    res = a_as5600_verify_check(handle, reg, data, len, AS5600_BOOL_TRUE);            /* check the read */
+    if (res == 0)                                                                     /* if plausible */
+    {
+        return 0;                                                                     /* success return 0 */
+    }
+    if (res == 1)                                                                     /* if reserved bits */
+    {
+        handle->verify_reserved++;                                                    /* count the reserved bits event */
+    }
+    else
+    {
+        handle->verify_jump++;                                                        /* count the jump event */
+    }
+#if (AS5600_STATS_ENABLE == 1)
+    handle->stats.retries++;                                                          /* count the retry */
+#endif
+    if (a_as5600_iic_read(handle, reg, data, len) != 0)                               /* read again */
+    {
+        return 1;                                                                     /* return error */
+    }
+    if (a_as5600_verify_check(handle, reg, data, len, AS5600_BOOL_FALSE) != 0)        /* check the reserved bits */
+    {
+        handle->debug_print("as5600: reserved bits are set.\n");                      /* reserved bits are set */
+
+        return 1;                                                                     /* return error */
+    }
+
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      read bytes with the tear free verification
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  reg iic register address
+ * @param[out] *data pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_as5600_verify_read(as5600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    if (a_as5600_iic_read(handle, reg, data, len) != 0)        /* read */
+    {
+        return 1;                                              /* return error */
+    }
+
+    return a_as5600_verify_sample(handle, reg, data, len);     /* verify the read */
+}
+
+/**
+ * @brief      read bytes through the shadow cache
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  reg iic register address
+ * @param[out] *data pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the shadow cache is loaded by one burst read when it is invalid
+ */
+static uint8_t a_as5600_shadow_read(as5600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint16_t i;
+
+    if ((handle->shadow_enable != 1) ||                                              /* check the shadow enable */
+        (reg < AS5600_REG_ZPOS_H) ||                                                 /* check the start */
+        (((uint16_t)reg + len) > (AS5600_REG_CONF_L + 1)))                           /* check the end */
+    {
+        return a_as5600_iic_read(handle, reg, data, len);                            /* read from the bus */
+    }
+    if (handle->shadow_valid != 1)                                                   /* if the shadow is invalid */
+    {
+        if (a_as5600_iic_read(handle, AS5600_REG_ZPOS_H, handle->shadow, 8) != 0)    /* load the shadow cache */
+        {
+            return 1;                                                                /* return error */
+        }
+        handle->shadow_valid = 1;                                                    /* flag the shadow valid */
+    }
+    for (i = 0; i < len; i++)                                                        /* copy all */
+    {
+        data[i] = handle->shadow[reg - AS5600_REG_ZPOS_H + i];                       /* copy from the shadow */
+    }
+
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     write register fields by one burst
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] *list pointer to a field value list
+ * @param[in] num list length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 4 read failed
+ * @note      all fields must be valid and writable,
+ *            the touched span is read through the shadow cache only if one register is partly covered
+ */
+static uint8_t a_as5600_field_write(as5600_handle_t *handle, const as5600_field_value_t *list, uint8_t num)
+{
+    uint8_t i;
+    uint8_t reg;
+    uint8_t len;
+    uint8_t start;
+    uint8_t stop;
+    uint8_t partial;
+    uint16_t mask;
+    uint16_t word;
+    const as5600_field_desc_t *desc;
+    uint8_t buf[AS5600_REG_CONF_L + 1];
+    uint8_t cover[AS5600_REG_CONF_L + 1];
+    uint8_t prev[AS5600_REG_CONF_L + 1];
+
+    if (num == 0)                                                                 /* check the num */
+    {
+        return 0;                                                                 /* success return 0 */
+    }
+    for (i = 0; i < (AS5600_REG_CONF_L + 1); i++)                                 /* clear all */
+    {
+        buf[i] = 0;                                                               /* clear the data */
+        cover[i] = 0;                                                             /* clear the covered bits */
+    }
+    start = AS5600_REG_CONF_L;                                                    /* init the start */
+    stop = AS5600_REG_ZPOS_H;                                                     /* init the stop */
+    for (i = 0; i < num; i++)                                                     /* merge all fields */
+    {
+        desc = &gs_field_table[list[i].field];                                    /* get the descriptor */
+        reg = desc->reg;                                                          /* get the register */
+        len = ((desc->shift + desc->width) > 8) ? 2 : 1;                          /* get the word length */
+        mask = (uint16_t)(((1U << desc->width) - 1) << desc->shift);              /* get the field mask */
+        word = (uint16_t)((list[i].value << desc->shift) & mask);                 /* get the field bits */
+        if ((desc->flag & AS5600_FIELD_FLAG_WORD) != 0)                           /* if the field owns the word */
+        {
+            mask = (len == 2) ? 0xFFFF : 0xFF;                                    /* cover the reserved bits */
+        }
+        if (len == 2)                                                             /* if a two registers field */
+        {
+            buf[reg] = (uint8_t)((buf[reg] & ~(mask >> 8)) | (word >> 8));        /* set the high part */
+            cover[reg] |= (uint8_t)(mask >> 8);                                   /* cover the high part */
+            reg++;                                                                /* low register */
+        }
+        buf[reg] = (uint8_t)((buf[reg] & ~(mask & 0xFF)) | (word & 0xFF));        /* set the low part */
+        cover[reg] |= (uint8_t)(mask & 0xFF);                                     /* cover the low part */
+        if (desc->reg < start)                                                    /* check the start */
+        {
+            start = desc->reg;                                                    /* set the start */
+        }
+        if (reg > stop)                                                           /* check the stop */
+        {
+            stop = reg;                                                           /* set the stop */
+        }
+    }
+    partial = 0;                                                                  /* init 0 */
+    for (reg = start; reg <= stop; reg++)                                         /* check the span */
+    {
+        if (cover[reg] != 0xFF)                                                   /* if partly covered */
+        {
+            partial = 1;                                                          /* flag partial */
+        }
+    }
+    len = (uint8_t)(stop - start + 1);                                            /* get the span length */
+    if (partial != 0)                                                             /* if the old bits are needed */
+    {
+        if (a_as5600_shadow_read(handle, start, &prev[start], len) != 0)          /* read the span */
+        {
+            return 4;                                                             /* return error */
+        }
+        for (reg = start; reg <= stop; reg++)                                     /* merge the span */
+        {
+            buf[reg] = (uint8_t)((prev[reg] & ~cover[reg]) | buf[reg]);           /* keep the other bits */
+        }
+    }
+    if (a_as5600_iic_write(handle, start, &buf[start], len) != 0)                 /* write the span */
+    {
+        return 1;                                                                 /* return error */
+    }
+
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     apply the software zero offset and direction to a raw angle
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] raw raw angle from the chip
+ * @return    adjusted raw angle
+ * @note      the identity when the offset is 0 and the direction is not inverted
+ */
+static uint16_t a_as5600_raw_adjust(as5600_handle_t *handle, uint16_t raw)
+{
+    if (handle->zero_invert != 0)                                      /* if inverted */
+    {
+        return (uint16_t)((handle->zero_offset - raw) & 0xFFF);        /* count down from the zero */
+    }
+    else
+    {
+        return (uint16_t)((raw - handle->zero_offset) & 0xFFF);        /* count up from the zero */
+    }
+}
+
+/**
+ * @brief         read register fields
+ * @param[in]     *handle pointer to an as5600 handle structure
+ * @param[in,out] *list pointer to a field value list
+ * @param[in]     num list length
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          all fields must be valid, each touched register block is read by one burst
+ *                and the undefined registers between the blocks are never read,
+ *                the raw angle field gets the software zero like as5600_get_raw_angle
+ */
+static uint8_t a_as5600_field_read(as5600_handle_t *handle, as5600_field_value_t *list, uint8_t num)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t j;
+    uint8_t reg;
+    uint8_t len;
+    uint16_t word;
+    const as5600_field_desc_t *desc;
+    uint8_t start[3];
+    uint8_t stop[3];
+    uint8_t buf[AS5600_REG_MAGNITUDE_L + 1];
+
+    for (j = 0; j < 3; j++)                                                                   /* clear all blocks */
+    {
+        start[j] = 0xFF;                                                                      /* init the start */
+        stop[j] = 0;                                                                          /* init the stop */
+    }
+    for (i = 0; i < num; i++)                                                                 /* find the spans */
+    {
+        desc = &gs_field_table[list[i].field];                                                /* get the descriptor */
+        reg = desc->reg;                                                                      /* get the register */
+        len = ((desc->shift + desc->width) > 8) ? 2 : 1;                                      /* get the word length */
+        if (reg <= AS5600_REG_CONF_L)                                                         /* config block */
+        {
+            j = 0;                                                                            /* block 0 */
+        }
+        else if (reg <= AS5600_REG_ANGLE_L)                                                   /* output block */
+        {
+            j = 1;                                                                            /* block 1 */
+        }
+        else                                                                                  /* magnet block */
+        {
+            j = 2;                                                                            /* block 2 */
+        }
+        if (reg < start[j])                                                                   /* check the start */
+        {
+            start[j] = reg;                                                                   /* set the start */
+        }
+        if ((reg + len - 1) > stop[j])                                                        /* check the stop */
+        {
+            stop[j] = (uint8_t)(reg + len - 1);                                               /* set the stop */
+        }
+    }
+    for (j = 0; j < 3; j++)                                                                   /* read all touched blocks */
+    {
+        if (start[j] <= stop[j])                                                              /* if the block is touched */
+        {
+            len = (uint8_t)(stop[j] - start[j] + 1);                                          /* get the span length */
+            if (j == 0)                                                                       /* if the config block */
+            {
+                res = a_as5600_shadow_read(handle, start[j], &buf[start[j]], len);            /* read through the shadow */
+            }
+            else
+            {
+                res = a_as5600_verify_read(handle, start[j], &buf[start[j]], len);            /* read with the verification */
+            }
+            if (res != 0)                                                                     /* check the result */
+            {
+                return 1;                                                                     /* return error */
+            }
+        }
+    }
+    for (i = 0; i < num; i++)                                                                 /* extract all fields */
+    {
+        desc = &gs_field_table[list[i].field];                                                /* get the descriptor */
+        reg = desc->reg;                                                                      /* get the register */
+        if ((desc->shift + desc->width) > 8)                                                  /* if a two registers field */
+        {
+            word = (uint16_t)(((uint16_t)buf[reg] << 8) | buf[reg + 1]);                      /* get the big endian word */
+        }
+        else
+        {
+            word = buf[reg];                                                                  /* get the byte */
+        }
+        list[i].value = (uint16_t)((word >> desc->shift) & ((1U << desc->width) - 1));        /* get the field */
+        if (list[i].field == AS5600_FIELD_RAW_ANGLE)                                          /* if the raw angle */
+        {
+            list[i].value = a_as5600_raw_adjust(handle, list[i].value);                       /* apply the software zero */
+        }
+    }
+
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set one register field for a thin setter
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] field register field
+ * @param[in] value field value
+ * @param[in] *get_msg pointer to the read failure message
+ * @param[in] *set_msg pointer to the write failure message
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      field must be writable, the value is masked to the field width
+ */
+static uint8_t a_as5600_field_set_one(as5600_handle_t *handle, as5600_field_t field, uint16_t value,
+                                      const char *get_msg, const char *set_msg)
+{
+    uint8_t res;
+    as5600_field_value_t item;
+
+    if (handle == NULL)                                             /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (handle->inited != 1)                                        /* check handle initialization */
+    {
+        return 3;                                                   /* return error */
+    }
+
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_FIELD_SET);        /* set the stats api */
+    item.field = field;                                             /* set the field */
+    item.value = value;                                             /* set the value */
+    res = a_as5600_field_write(handle, &item, 1);                   /* write the field */
+    if (res == 4)                                                   /* check the read result */
+    {
+        handle->debug_print(get_msg);                               /* print the read failure */
+
+        return 1;                                                   /* return error */
+    }
+    if (res != 0)                                                   /* check the write result */
+    {
+        handle->debug_print(set_msg);                               /* print the write failure */
+
+        return 1;                                                   /* return error */
+    }
+
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get one register field for a thin getter
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  field register field
+ * @param[out] *value pointer to a field value buffer
+ * @param[in]  *msg pointer to a failure message
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       field must be valid
+ */
+static uint8_t a_as5600_field_get_one(as5600_handle_t *handle, as5600_field_t field, uint16_t *value, const char *msg)
+{
+    as5600_field_value_t item;
+
+    if (handle == NULL)                                             /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (handle->inited != 1)                                        /* check handle initialization */
+    {
+        return 3;                                                   /* return error */
+    }
+
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_FIELD_GET);        /* set the stats api */
+    item.field = field;                                             /* set the field */
+    if (a_as5600_field_read(handle, &item, 1) != 0)                 /* read the field */
+    {
+        handle->debug_print(msg);                                   /* print the failure */
+
+        return 1;                                                   /* return error */
+    }
+    *value = item.value;                                            /* set the value */
+
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief     check a register field and its value
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] *item pointer to a field value
+ * @param[in] write bool value, check for a write or not
+ * @return    status code
+ *            - 0 success
+ *            - 4 field is invalid
+ *            - 5 field is read only
+ *            - 6 value is over the field width
+ * @note      none
+ */
+static uint8_t a_as5600_field_check(as5600_handle_t *handle, const as5600_field_value_t *item, as5600_bool_t write)
+{
+    const as5600_field_desc_t *desc;
+
+    if ((uint32_t)item->field >= AS5600_FIELD_NUM)                              /* check the field */
+    {
+        handle->debug_print("as5600: field is invalid.\n");                     /* field is invalid */
+
+        return 4;                                                               /* return error */
+    }
+    if (write == AS5600_BOOL_FALSE)                                             /* if only read */
+    {
+        return 0;                                                               /* success return 0 */
+    }
+    desc = &gs_field_table[item->field];                                        /* get the descriptor */
+    if ((desc->flag & AS5600_FIELD_FLAG_WRITE) == 0)                            /* check the access */
+    {
+        handle->debug_print("as5600: field is read only.\n");                   /* field is read only */
+
+        return 5;                                                               /* return error */
+    }
+    if ((uint32_t)item->value > ((1U << desc->width) - 1))                      /* check the value */
+    {
+        handle->debug_print("as5600: value is over the field width.\n");        /* value is over the field width */
+
+        return 6;                                                               /* return error */
+    }
+
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     update the output range cache
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] start start position
+ * @param[in] stop stop position
+ * @param[in] ang max angle
+ * @note      the span is taken from the max angle, then the stop position and is one turn if none is set,
+ *            one of 4096 scaled angle steps over span raw steps is span << 8 in a 32 bit binary angle
+ */
+static void a_as5600_range_update(as5600_handle_t *handle, uint16_t start, uint16_t stop, uint16_t ang)
+{
+    uint32_t span;
+
+    span = 0;                                                      /* init 0 */
+    if (ang != 0)                                                  /* if the max angle is set */
+    {
+        span = ang;                                                /* get the max angle */
+    }
+    else if (stop != 0)                                            /* if the stop position is set */
+    {
+        span = (uint32_t)((stop - start) & 0xFFF);                 /* get the span to the stop position */
+    }
+    if (span == 0)                                                 /* if no span */
+    {
+        span = 4096;                                               /* one turn */
+    }
+    handle->range_offset = (uint32_t)(start & 0xFFF) << 20;        /* set the start */
+    handle->range_scale = span << 8;                               /* set the scale */
+    handle->range_valid = 1;                                       /* flag the range valid */
+}
+
+/**
+ * @brief     convert the raw angle to a fixed point angle
+ * @param[in] format fixed point format
+ * @param[in] raw raw angle
+ * @return    fixed point angle
+ * @note      format must be valid
+ */
+static int32_t a_as5600_raw_to_fixed(as5600_fixed_format_t format, uint16_t raw)
+{
+    if (format == AS5600_FIXED_FORMAT_DEG_Q16)              /* degrees in q16.16 */
+    {
+        return (int32_t)raw * 5760;                         /* 360 * 65536 / 4096 */
+    }
+    else if (format == AS5600_FIXED_FORMAT_TURN_Q15)        /* turns in q1.15 */
+    {
+        return (int32_t)raw << 3;                           /* 32768 / 4096 */
+    }
+    else                                                    /* 16 bit binary angle */
+    {
+        return (int32_t)raw << 4;                           /* 65536 / 4096 */
+    }
+}
+
+/**
+ * @brief      update the multi turn position
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  raw raw angle
+ * @param[out] *position pointer to a position buffer
+ * @param[out] *alias pointer to an alias flag buffer
+ * @note       none
+ */
+static void a_as5600_multi_turn_update(as5600_handle_t *handle, uint16_t raw, int64_t *position, as5600_bool_t *alias)
+{
+    int16_t delta;
+
+    *alias = AS5600_BOOL_FALSE;                                                           /* no alias */
+    if (handle->turn_valid == 0)                                                          /* first sample */
+    {
+        handle->turn_position = raw;                                                      /* start from the raw angle */
+        handle->turn_valid = 1;                                                           /* set valid */
+    }
+    else
+    {
+        delta = (int16_t)((raw - handle->turn_last) & 0xFFF);                             /* get the step */
+        if (delta >= 2048)                                                                /* take the shortest path */
+        {
+            delta = (int16_t)(delta - 4096);                                              /* backward */
+        }
+        if ((delta > (int16_t)handle->turn_max_step) ||
+            (delta < -(int16_t)handle->turn_max_step))                                    /* check the step */
+        {
+            handle->turn_alias++;                                                         /* alias counter++ */
+            *alias = AS5600_BOOL_TRUE;                                                    /* flag alias */
+        }
+        handle->turn_position += delta;                                                   /* accumulate */
+    }
+    handle->turn_last = raw;                                                              /* save the last sample */
+    *position = handle->turn_position;                                                    /* set the position */
+}
+
+/**
+ * @brief     initialize the chip
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      none
+ */
+uint8_t as5600_init(as5600_handle_t *handle)
+{
+    uint8_t res;
+
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (handle->debug_print == NULL)                                            /* check debug_print */
+    {
+        return 3;                                                               /* return error */
+    }
+    if ((handle->iic_init == NULL) && (handle->iic_init_ex == NULL))            /* check iic_init */
+    {
+        handle->debug_print("as5600: iic_init is null.\n");                     /* iic_init is null */
+
+        return 3;                                                               /* return error */
+    }
+    if ((handle->iic_deinit == NULL) && (handle->iic_deinit_ex == NULL))        /* check iic_deinit */
+    {
+        handle->debug_print("as5600: iic_deinit is null.\n");                   /* iic_deinit is null */
+
+        return 3;                                                               /* return error */
+    }
+    if ((handle->iic_read == NULL) && (handle->iic_read_ex == NULL))            /* check iic_read */
+    {
+        handle->debug_print("as5600: iic_read is null.\n");                     /* iic_read is null */
+
+        return 3;                                                               /* return error */
+    }
+    if ((handle->iic_write == NULL) && (handle->iic_write_ex == NULL))          /* check iic_write */
+    {
+        handle->debug_print("as5600: iic_write is null.\n");                    /* iic_write is null */
+
+        return 3;                                                               /* return error */
+    }
+    if (handle->delay_ms == NULL)                                               /* check delay_ms */
+    {
+        handle->debug_print("as5600: delay_ms is null.\n");                     /* delay_ms is null */
+
+        return 3;                                                               /* return error */
+    }
+
+    if (handle->iic_init_ex != NULL)                                            /* if the user data init is linked */
+    {
+        res = handle->iic_init_ex(handle->user_data);                           /* iic init */
+    }
+    else
+    {
+        res = handle->iic_init();                                               /* iic init */
+    }
+    if (res != 0)                                                               /* check the result */
+    {
+        handle->debug_print("as5600: iic init failed.\n");                      /* iic init failed */
+
+        return 1;                                                               /* return error */
+    }
+    handle->poll_enable = 0;                                                    /* disable the poll read */
+    handle->poll_ready = 0;                                                     /* clear the ready flag */
+    handle->shadow_valid = 0;                                                   /* invalidate the shadow cache */
+    handle->range_valid = 0;                                                    /* invalidate the range cache */
+    handle->zero_offset = 0;                                                    /* no software zero offset */
+    handle->zero_invert = 0;                                                    /* no software direction inversion */
+    handle->verify_enable = 0;                                                  /* no read verification */
+    handle->verify_valid = 0;                                                   /* no last sample */
+    handle->verify_max_step = 1024;                                             /* default quarter turn */
+    handle->verify_reserved = 0;                                                /* clear the reserved bits events */
+    handle->verify_jump = 0;                                                    /* clear the jump events */
+    handle->turn_valid = 0;                                                     /* clear the multi turn sample */
+    handle->turn_max_step = 1024;                                               /* default quarter turn */
+    handle->turn_alias = 0;                                                     /* clear the alias counter */
+    handle->turn_position = 0;                                                  /* clear the position */
+    handle->async_state = AS5600_ASYNC_STATE_IDLE;                              /* no async transfer */
+#if (AS5600_STATS_ENABLE == 1)
+    handle->stats_api = AS5600_STATS_API_REGISTER;                              /* set the register api */
+    handle->stats_call = 0;                                                     /* no open call */
+    memset(&handle->stats, 0, sizeof(as5600_stats_t));                          /* clear the stats */
+#endif
+    handle->inited = 1;                                                         /* flag finish initialization */
+
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     close the chip
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t as5600_deinit(as5600_handle_t *handle)
+{
+    uint8_t res;
+
+    if (handle == NULL)                                             /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (handle->inited != 1)                                        /* check handle initialization */
+    {
+        return 3;                                                   /* return error */
+    }
+
+    if (handle->iic_deinit_ex != NULL)                              /* if the user data deinit is linked */
+    {
+        res = handle->iic_deinit_ex(handle->user_data);             /* iic deinit */
+    }
+    else
+    {
+        res = handle->iic_deinit();                                 /* iic deinit */
+    }
+    if (res != 0)                                                   /* check the result */
+    {
+        handle->debug_print("as5600: iic deinit failed.\n");        /* iic deinit failed */
+
+        return 1;                                                   /* return error */
+    }
+    handle->inited = 0;                                             /* flag close */
+
+    return 0;                                                       /* success return 0 */
+}
+
+#if (AS5600_FLOAT_ENABLE == 1)
+
+/**
+ * @brief      read the magnetic angle
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *angle_raw pointer to a raw angle buffer
+ * @param[out] *deg pointer to a converted angle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_read(as5600_handle_t *handle, uint16_t *angle_raw, float *deg)
+{
+    uint8_t buf[2];
+
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_READ);                        /* set the stats api */
+    if (a_as5600_verify_read(handle, AS5600_REG_RAW_ANGLE_H, buf, 2) != 0)     /* read conf */
+    {
+        handle->debug_print("as5600: get raw angle failed.\n");                /* get raw angle failed */
+
+        return 1;                                                              /* return error */
+    }
+    else
+    {
+        a_as5600_sample_stamp(handle, 1);                                      /* stamp the sample */
+        *angle_raw = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];          /* set the raw angle */
+        *angle_raw = a_as5600_raw_adjust(handle, *angle_raw);                  /* apply the software zero */
+        *deg = (float)(*angle_raw ) * (360.0f / 4096.0f);                      /* convert the raw data to the real data */
+
+        return 0;                                                              /* success return 0 */
+    }
+}
+
+/**
+ * @brief      convert the angle to the register raw data
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  deg angle
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_angle_convert_to_register(as5600_handle_t *handle, float deg, uint16_t *reg)
+{
+    if (handle == NULL)                                  /* check handle */
+    {
+        return 2;                                        /* return error */
+    }
+    if (handle->inited != 1)                             /* check handle initialization */
+    {
+        return 3;                                        /* return error */
+    }
+
+    *reg = (uint16_t)(deg / (360.0f / 4096.0f));         /* convert real data to register data */
+
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief      convert the register raw data to the angle
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *deg pointer to an angle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_angle_convert_to_data(as5600_handle_t *handle, uint16_t reg, float *deg)
+{
+    if (handle == NULL)                              /* check handle */
+    {
+        return 2;                                    /* return error */
+    }
+    if (handle->inited != 1)                         /* check handle initialization */
+    {
+        return 3;                                    /* return error */
+    }
+
+    *deg = (float)(reg) * (360.0f / 4096.0f);        /* convert raw data to real data */
+
+    return 0;                                        /* success return 0 */
+}
+
+#endif
+
+/**
+ * @brief      read the magnetic angle in a fixed point format
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  format fixed point format
+ * @param[out] *angle_raw pointer to a raw angle buffer
+ * @param[out] *angle pointer to a converted angle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 format is invalid
+ * @note       integer only
+ */
+uint8_t as5600_read_fixed(as5600_handle_t *handle, as5600_fixed_format_t format, uint16_t *angle_raw, int32_t *angle)
+{
+    uint8_t buf[2];
+
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+    if (format > AS5600_FIXED_FORMAT_BAM16)                                    /* check the format */
+    {
+        handle->debug_print("as5600: format is invalid.\n");                   /* format is invalid */
+
+        return 4;                                                              /* return error */
+    }
+
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_READ_FIXED);                  /* set the stats api */
+    if (a_as5600_verify_read(handle, AS5600_REG_RAW_ANGLE_H, buf, 2) != 0)     /* read raw angle */
+    {
+        handle->debug_print("as5600: get raw angle failed.\n");                /* get raw angle failed */
+
+        return 1;                                                              /* return error */
+    }
+    a_as5600_sample_stamp(handle, 1);                                          /* stamp the sample */
+    *angle_raw = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];              /* set the raw angle */
+    *angle_raw = a_as5600_raw_adjust(handle, *angle_raw);                      /* apply the software zero */
+    *angle = a_as5600_raw_to_fixed(format, *angle_raw);                        /* convert the raw data to the fixed data */
+
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      convert a fixed point angle to the register raw data
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  format fixed point format
+ * @param[in]  angle fixed point angle
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 format is invalid
+ *             - 5 angle is over one turn
+ * @note       0 <= angle < one turn
+ */
+uint8_t as5600_angle_convert_from_fixed(as5600_handle_t *handle, as5600_fixed_format_t format, int32_t angle, uint16_t *reg)
+{
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+
+    if (format == AS5600_FIXED_FORMAT_DEG_Q16)                            /* degrees in q16.16 */
+    {
+        if ((angle < 0) || (angle >= (360L << 16)))                       /* check the angle */
+        {
+            handle->debug_print("as5600: angle is over one turn.\n");     /* angle is over one turn */
+
+            return 5;                                                     /* return error */
+        }
+        *reg = (uint16_t)(angle / 5760);                                  /* 360 * 65536 / 4096 */
+    }
+    else if (format == AS5600_FIXED_FORMAT_TURN_Q15)                      /* turns in q1.15 */
+    {
+        if ((angle < 0) || (angle >= 32768L))                             /* check the angle */
+        {
+            handle->debug_print("as5600: angle is over one turn.\n");     /* angle is over one turn */
+
+            return 5;                                                     /* return error */
+        }
+        *reg = (uint16_t)(angle >> 3);                                    /* 32768 / 4096 */
+    }
+    else if (format == AS5600_FIXED_FORMAT_BAM16)                         /* 16 bit binary angle */
+    {
+        if ((angle < 0) || (angle >= 65536L))                             /* check the angle */
+        {
+            handle->debug_print("as5600: angle is over one turn.\n");     /* angle is over one turn */
+
+            return 5;                                                     /* return error */
+        }
+        *reg = (uint16_t)(angle >> 4);                                    /* 65536 / 4096 */
+    }
+    else
+    {
+        handle->debug_print("as5600: format is invalid.\n");              /* format is invalid */
+
+        return 4;                                                         /* return error */
+    }
+
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      convert the register raw data to a fixed point angle
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  format fixed point format
+ * @param[in]  reg register raw data
+ * @param[out] *angle pointer to a fixed point angle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 format is invalid
+ * @note       none
+ */
+uint8_t as5600_angle_convert_to_fixed(as5600_handle_t *handle, as5600_fixed_format_t format, uint16_t reg, int32_t *angle)
+{
+    if (handle == NULL)                                            /* check handle */
+    {
+        return 2;                                                  /* return error */
+    }
+    if (handle->inited != 1)                                       /* check handle initialization */
+    {
+        return 3;                                                  /* return error */
+    }
+    if (format > AS5600_FIXED_FORMAT_BAM16)                        /* check the format */
+    {
+        handle->debug_print("as5600: format is invalid.\n");       /* format is invalid */
+
+        return 4;                                                  /* return error */
+    }
+
+    *angle = a_as5600_raw_to_fixed(format, reg);                   /* convert raw data to fixed data */
+
+    return 0;                                                      /* success return 0 */
+}
+
+/**
+ * @brief     load the output range and cache the scaled angle conversion
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 range load failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the start position, stop position and max angle are read once,
+ *            any later write to them drops the cache except as5600_set_output_range which refreshes it
+ */
+uint8_t as5600_range_load(as5600_handle_t *handle)
+{
+    uint8_t buf[6];
+
+    if (handle == NULL)                                                       /* check handle */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_REGISTER);                   /* set the stats api */
+    if (a_as5600_shadow_read(handle, AS5600_REG_ZPOS_H, buf, 6) != 0)         /* read the range */
+    {
+        handle->debug_print("as5600: range load failed.\n");                  /* range load failed */
+
+        return 1;                                                             /* return error */
+    }
+    a_as5600_range_update(handle,
+                          (uint16_t)(((buf[0] & 0xF) << 8) | buf[1]),
+                          (uint16_t)(((buf[2] & 0xF) << 8) | buf[3]),
+                          (uint16_t)(((buf[4] & 0xF) << 8) | buf[5]));        /* update the range cache */
+
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      convert the scaled angle register to a fixed point angle
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  format fixed point format
+ * @param[in]  reg scaled angle register raw data
+ * @param[out] *angle pointer to a fixed point angle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 format is invalid
+ *             - 5 range is not loaded
+ * @note       the angle is the physical position, start position and span included
+ */
+uint8_t as5600_range_convert_to_fixed(as5600_handle_t *handle, as5600_fixed_format_t format, uint16_t reg, int32_t *angle)
+{
+    uint32_t bam;
+
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (format > AS5600_FIXED_FORMAT_BAM16)                                            /* check the format */
+    {
+        handle->debug_print("as5600: format is invalid.\n");                           /* format is invalid */
+
+        return 4;                                                                      /* return error */
+    }
+    if (handle->range_valid != 1)                                                      /* check the range */
+    {
+        handle->debug_print("as5600: range is not loaded.\n");                         /* range is not loaded */
+
+        return 5;                                                                      /* return error */
+    }
+
+    bam = handle->range_offset + (uint32_t)(reg & 0xFFF) * handle->range_scale;        /* get the binary angle, wrap safe */
+    if (format == AS5600_FIXED_FORMAT_TURN_Q15)                                        /* if turn q1.15 */
+    {
+        *angle = (int32_t)(bam >> 17);                                                 /* 32768 / 2^32 */
+    }
+    else if (format == AS5600_FIXED_FORMAT_BAM16)                                      /* if bam16 */
+    {
+        *angle = (int32_t)(bam >> 16);                                                 /* 65536 / 2^32 */
+    }
+    else
+    {
+        *angle = (int32_t)(((uint64_t)bam * 360) >> 16);                               /* (360 << 16) / 2^32 */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+#if (AS5600_FLOAT_ENABLE == 1)
+
+/**
+ * @brief      convert the scaled angle register to degrees
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  reg scaled angle register raw data
+ * @param[out] *deg pointer to a degrees buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is not loaded
+ * @note       the angle is the physical position, start position and span included
+ */
+uint8_t as5600_range_convert_to_data(as5600_handle_t *handle, uint16_t reg, float *deg)
+{
+    uint32_t bam;
+
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (handle->range_valid != 1)                                                      /* check the range */
+    {
+        handle->debug_print("as5600: range is not loaded.\n");                         /* range is not loaded */
+
+        return 4;                                                                      /* return error */
+    }
+
+    bam = handle->range_offset + (uint32_t)(reg & 0xFFF) * handle->range_scale;        /* get the binary angle, wrap safe */
+    *deg = (float)bam * (360.0f / 4294967296.0f);                                      /* convert to degrees */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+#endif
+
+#if (AS5600_FLOAT_ENABLE == 1)
+
+/**
+ * @brief      convert an array of register raw data to angles in degrees
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  *reg pointer to a register raw data array
+ * @param[out] *deg pointer to an angle array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       reg and deg must not overlap
+ */
+uint8_t as5600_angle_convert_to_data_array(as5600_handle_t *handle, const uint16_t *reg, float *deg, uint32_t len)
+{
+    uint32_t i;
+    const uint16_t *restrict in;
+    float *restrict out;
+
+    if (handle == NULL)                                         /* check handle */
+    {
+        return 2;                                               /* return error */
+    }
+    if (handle->inited != 1)                                    /* check handle initialization */
+    {
+        return 3;                                               /* return error */
+    }
+
+    in = reg;                                                   /* set the input */
+    out = deg;                                                  /* set the output */
+    for (i = 0; i < len; i++)                                   /* convert all */
+    {
+        out[i] = (float)(in[i]) * (360.0f / 4096.0f);           /* convert raw data to real data */
+    }
+
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief      convert an array of register raw data to angles in radians
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  *reg pointer to a register raw data array
+ * @param[out] *rad pointer to an angle array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       reg and rad must not overlap
+ */
+uint8_t as5600_angle_convert_to_rad_array(as5600_handle_t *handle, const uint16_t *reg, float *rad, uint32_t len)
+{
+    uint32_t i;
+    const uint16_t *restrict in;
+    float *restrict out;
+
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+
+    in = reg;                                                             /* set the input */
+    out = rad;                                                            /* set the output */
+    for (i = 0; i < len; i++)                                             /* convert all */
+    {
+        out[i] = (float)(in[i]) * (6.28318530718f / 4096.0f);             /* convert raw data to radians */
+    }
+
+    return 0;                                                             /* success return 0 */
+}
+
+#endif
+
+/**
+ * @brief      convert an array of register raw data to fixed point angles
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  format fixed point format
+ * @param[in]  *reg pointer to a register raw data array
+ * @param[out] *angle pointer to a fixed point angle array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 format is invalid
+ * @note       reg and angle must not overlap
+ */
+uint8_t as5600_angle_convert_to_fixed_array(as5600_handle_t *handle, as5600_fixed_format_t format,
+                                            const uint16_t *reg, int32_t *angle, uint32_t len)
+{
+    uint32_t i;
+    const uint16_t *restrict in;
+    int32_t *restrict out;
+
+    if (handle == NULL)                                            /* check handle */
+    {
+        return 2;                                                  /* return error */
+    }
+    if (handle->inited != 1)                                       /* check handle initialization */
+    {
+        return 3;                                                  /* return error */
+    }
+
+    in = reg;                                                      /* set the input */
+    out = angle;                                                   /* set the output */
+    if (format == AS5600_FIXED_FORMAT_DEG_Q16)                     /* degrees in q16.16 */
+    {
+        for (i = 0; i < len; i++)                                  /* convert all */
+        {
+            out[i] = (int32_t)in[i] * 5760;                        /* 360 * 65536 / 4096 */
+        }
+    }
+    else if (format == AS5600_FIXED_FORMAT_TURN_Q15)               /* turns in q1.15 */
+    {
+        for (i = 0; i < len; i++)                                  /* convert all */
+        {
+            out[i] = (int32_t)in[i] << 3;                          /* 32768 / 4096 */
+        }
+    }
+    else if (format == AS5600_FIXED_FORMAT_BAM16)                  /* 16 bit binary angle */
+    {
+        for (i = 0; i < len; i++)                                  /* convert all */
+        {
+            out[i] = (int32_t)in[i] << 4;                          /* 65536 / 4096 */
+        }
+    }
+    else
+    {
+        handle->debug_print("as5600: format is invalid.\n");       /* format is invalid */
+
+        return 4;                                                  /* return error */
+    }
+
+    return 0;                                                      /* success return 0 */
+}
+
+/**
+ * @brief         unwrap an array of register raw data to positions
+ * @param[in]     *handle pointer to an as5600 handle structure
+ * @param[in]     *reg pointer to a register raw data array
+ * @param[out]    *position pointer to a position array
+ * @param[in]     len array length
+ * @param[in,out] *last_raw pointer to the raw data before reg[0], it is set to the last raw data
+ * @param[in,out] *last_position pointer to the position of *last_raw, it is set to the last position
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          the position is 4096 per turn as in as5600_multi_turn_update and each step takes the shortest path,
+ *                consecutive blocks are chained by passing the same last_raw and last_position,
+ *                set them to reg[0] and reg[0] & 0xFFF before the first block, reg and position must not overlap
+ */
+uint8_t as5600_angle_unwrap_array(as5600_handle_t *handle, const uint16_t *reg, int64_t *position, uint32_t len,
+                                  uint16_t *last_raw, int64_t *last_position)
+{
+    uint32_t i;
+    int32_t delta;
+    int64_t pos;
+    uint16_t prev;
+    const uint16_t *restrict in;
+    int64_t *restrict out;
+
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    if (len == 0)                                                            /* check the length */
+    {
+        return 0;                                                            /* success return 0 */
+    }
+
+    in = reg;                                                                /* set the input */
+    out = position;                                                          /* set the output */
+    prev = *last_raw;                                                        /* get the last raw data */
+    pos = *last_position;                                                    /* get the last position */
+    for (i = 0; i < len; i++)                                                /* unwrap all */
+    {
+        delta = (int32_t)((in[i] - prev) & 0xFFF);                           /* get the step */
+        delta -= (delta >= 2048) ? 4096 : 0;                                 /* take the shortest path */
+        pos += delta;                                                        /* accumulate in 64 bits */
+        out[i] = pos;                                                        /* set the position */
+        prev = in[i];                                                        /* save the raw data */
+    }
+    *last_raw = prev;                                                        /* set the last raw data */
+    *last_position = pos;                                                    /* set the last position */
+
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     set the start position
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] pos start position
+ * @return    status code
+ *            - 0 success
+ *            - 1 set start position failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 pos is over 0xFFF
+ * @note      none
+ */
+uint8_t as5600_set_start_position(as5600_handle_t *handle, uint16_t pos)
+{
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    if (pos > 0xFFF)                                                              /* check the pos */
+    {
+        handle->debug_print("as5600: pos is over 0xFFF.\n");                      /* pos is over 0xFFF */
+
+        return 4;                                                                 /* return error */
+    }
+
+    return a_as5600_field_set_one(handle, AS5600_FIELD_START_POSITION, pos,
+                                  "as5600: get start position failed.\n",
+                                  "as5600: set start position failed.\n");        /* set the field */
+}
+
+/**
+ * @brief      get the start position
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *pos pointer to a start position buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get start position failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_start_position(as5600_handle_t *handle, uint16_t *pos)
+{
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_START_POSITION, &value,
+                                 "as5600: get start position failed.\n");        /* get the field */
+    if (res == 0)                                                                /* check the result */
+    {
+        *pos = value;                                                            /* set the value */
+    }
+
+    return res;                                                                  /* return the result */
+}
+
+/**
+ * @brief     set the stop position
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] pos stop position
+ * @return    status code
+ *            - 0 success
+ *            - 1 set stop position failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 pos is over 0xFFF
+ * @note      none
+ */
+uint8_t as5600_set_stop_position(as5600_handle_t *handle, uint16_t pos)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+    if (pos > 0xFFF)                                                             /* check the pos */
+    {
+        handle->debug_print("as5600: pos is over 0xFFF.\n");                     /* pos is over 0xFFF */
+
+        return 4;                                                                /* return error */
+    }
+
+    return a_as5600_field_set_one(handle, AS5600_FIELD_STOP_POSITION, pos,
+                                  "as5600: get stop position failed.\n",
+                                  "as5600: set stop position failed.\n");        /* set the field */
+}
+
+/**
+ * @brief      get the stop position
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *pos pointer to a stop position buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stop position failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_stop_position(as5600_handle_t *handle, uint16_t *pos)
+{
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_STOP_POSITION, &value,
+                                 "as5600: get stop position failed.\n");        /* get the field */
+    if (res == 0)                                                               /* check the result */
+    {
+        *pos = value;                                                           /* set the value */
+    }
+
+    return res;                                                                 /* return the result */
+}
+
+/**
+ * @brief     set the max angle
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] ang max angle
+ * @return    status code
+ *            - 0 success
+ *            - 1 set max angle failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 ang is over 0xFFF
+ * @note      none
+ */
+uint8_t as5600_set_max_angle(as5600_handle_t *handle, uint16_t ang)
+{
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    if (ang > 0xFFF)                                                         /* check the ang */
+    {
+        handle->debug_print("as5600: ang is over 0xFFF.\n");                 /* ang is over 0xFFF */
+
+        return 4;                                                            /* return error */
+    }
+
+    return a_as5600_field_set_one(handle, AS5600_FIELD_MAX_ANGLE, ang,
+                                  "as5600: get max angle failed.\n",
+                                  "as5600: set max angle failed.\n");        /* set the field */
+}
+
+/**
+ * @brief      get the max angle
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *ang pointer to a max angle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get max angle failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_max_angle(as5600_handle_t *handle, uint16_t *ang)
+{
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_MAX_ANGLE, &value,
+                                 "as5600: get max angle failed.\n");        /* get the field */
+    if (res == 0)                                                           /* check the result */
+    {
+        *ang = value;                                                       /* set the value */
+    }
+
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief     set the start position, stop position and max angle in one transaction
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] start start position
+ * @param[in] stop stop position, 0 means not used
+ * @param[in] ang max angle, 0 means not used
+ * @return    status code
+ *            - 0 success
+ *            - 1 set output range failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 start, stop or ang is over 0xFFF
+ *            - 5 span is below 18 degrees
+ *            - 6 verify failed
+ * @note      the span from start to stop and the max angle must be at least AS5600_OUTPUT_RANGE_MIN,
+ *            registers from 0x01 to 0x06 are written by one burst and checked by one burst read back
+ */
+uint8_t as5600_set_output_range(as5600_handle_t *handle, uint16_t start, uint16_t stop, uint16_t ang)
+{
+    uint8_t i;
+    uint8_t buf[6];
+    as5600_field_value_t list[3];
+
+    if (handle == NULL)                                                                      /* check handle */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    if ((start > 0xFFF) || (stop > 0xFFF) || (ang > 0xFFF))                                  /* check the range */
+    {
+        handle->debug_print("as5600: start, stop or ang is over 0xFFF.\n");                  /* start, stop or ang is over 0xFFF */
+
+        return 4;                                                                            /* return error */
+    }
+    if (((stop != 0) && (((stop - start) & 0xFFF) < AS5600_OUTPUT_RANGE_MIN)) ||             /* check the stop span */
+        ((ang != 0) && (ang < AS5600_OUTPUT_RANGE_MIN)))                                     /* check the max angle */
+    {
+        handle->debug_print("as5600: span is below 18 degrees.\n");                          /* span is below 18 degrees */
+
+        return 5;                                                                            /* return error */
+    }
+
+    list[0].field = AS5600_FIELD_START_POSITION;                                             /* set the start field */
+    list[0].value = start;                                                                   /* set the start */
+    list[1].field = AS5600_FIELD_STOP_POSITION;                                              /* set the stop field */
+    list[1].value = stop;                                                                    /* set the stop */
+    list[2].field = AS5600_FIELD_MAX_ANGLE;                                                  /* set the max angle field */
+    list[2].value = ang;                                                                     /* set the max angle */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_OUTPUT_RANGE);                              /* set the stats api */
+    if (a_as5600_field_write(handle, list, 3) != 0)                                          /* write the range by one burst */
+    {
+        handle->debug_print("as5600: set output range failed.\n");                           /* set output range failed */
+
+        return 1;                                                                            /* return error */
+    }
+    if (a_as5600_iic_read(handle, AS5600_REG_ZPOS_H, buf, 6) != 0)                           /* read back from the chip */
+    {
+        handle->debug_print("as5600: set output range failed.\n");                           /* set output range failed */
+
+        return 1;                                                                            /* return error */
+    }
+    for (i = 0; i < 3; i++)                                                                  /* check all values */
+    {
+        if (((uint16_t)((buf[i * 2] & 0x0F) << 8) | buf[i * 2 + 1]) != list[i].value)        /* check the value */
+        {
+            handle->debug_print("as5600: verify failed.\n");                                 /* verify failed */
+
+            return 6;                                                                        /* return error */
+        }
+    }
+    a_as5600_range_update(handle, start, stop, ang);                                         /* refresh the range cache */
+
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the watch dog
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set watchdog failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t as5600_set_watch_dog(as5600_handle_t *handle, as5600_bool_t enable)
+{
+    return a_as5600_field_set_one(handle, AS5600_FIELD_WATCH_DOG, (uint16_t)enable,
+                                  "as5600: get conf failed.\n",
+                                  "as5600: set conf failed.\n");        /* set the field */
+}
+
+/**
+ * @brief      get the watch dog status
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get watchdog failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_watch_dog(as5600_handle_t *handle, as5600_bool_t *enable)
+{
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_WATCH_DOG, &value,
+                                 "as5600: get conf failed.\n");        /* get the field */
+    if (res == 0)                                                      /* check the result */
+    {
+        *enable = (as5600_bool_t)value;                                /* set the value */
+    }
+
+    return res;                                                        /* return the result */
+}
+
+/**
+ * @brief     set the fast filter threshold
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] threshold fast filter threshold
+ * @return    status code
+ *            - 0 success
+ *            - 1 set fast filter threshold failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t as5600_set_fast_filter_threshold(as5600_handle_t *handle, as5600_fast_filter_threshold_t threshold)
+{
+    return a_as5600_field_set_one(handle, AS5600_FIELD_FAST_FILTER_THRESHOLD, (uint16_t)threshold,
+                                  "as5600: get conf failed.\n",
+                                  "as5600: set conf failed.\n");        /* set the field */
+}
+
+/**
+ * @brief      get the fast filter threshold
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *threshold pointer to a fast filter threshold buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get fast filter threshold failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_fast_filter_threshold(as5600_handle_t *handle, as5600_fast_filter_threshold_t *threshold)
+{
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_FAST_FILTER_THRESHOLD, &value,
+                                 "as5600: get conf failed.\n");        /* get the field */
+    if (res == 0)                                                      /* check the result */
+    {
+        *threshold = (as5600_fast_filter_threshold_t)value;            /* set the value */
+    }
+
+    return res;                                                        /* return the result */
+}
+
+/**
+ * @brief     set the slow filter
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] filter slow filter
+ * @return    status code
+ *            - 0 success
+ *            - 1 set slow filter failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t as5600_set_slow_filter(as5600_handle_t *handle, as5600_slow_filter_t filter)
+{
+    return a_as5600_field_set_one(handle, AS5600_FIELD_SLOW_FILTER, (uint16_t)filter,
+                                  "as5600: get conf failed.\n",
+                                  "as5600: set conf failed.\n");        /* set the field */
+}
+
+/**
+ * @brief      get the slow filter
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *filter pointer to a slow filter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get slow filter failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_slow_filter(as5600_handle_t *handle, as5600_slow_filter_t *filter)
+{
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_SLOW_FILTER, &value,
+                                 "as5600: get conf failed.\n");        /* get the field */
+    if (res == 0)                                                      /* check the result */
+    {
+        *filter = (as5600_slow_filter_t)value;                         /* set the value */
+    }
+
+    return res;                                                        /* return the result */
+}
+
+/**
+ * @brief     set the pwm frequency
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] freq pwm frequency
+ * @return    status code
+ *            - 0 success
+ *            - 1 set pwm frequency failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t as5600_set_pwm_frequency(as5600_handle_t *handle, as5600_pwm_frequency_t freq)
+{
+    return a_as5600_field_set_one(handle, AS5600_FIELD_PWM_FREQUENCY, (uint16_t)freq,
+                                  "as5600: get conf failed.\n",
+                                  "as5600: set conf failed.\n");        /* set the field */
+}
+
+/**
+ * @brief      get the pwm frequency
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *freq pointer to a pwm frequency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get pwm frequency failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_pwm_frequency(as5600_handle_t *handle, as5600_pwm_frequency_t *freq)
+{
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_PWM_FREQUENCY, &value,
+                                 "as5600: get conf failed.\n");        /* get the field */
+    if (res == 0)                                                      /* check the result */
+    {
+        *freq = (as5600_pwm_frequency_t)value;                         /* set the value */
+    }
+
+    return res;                                                        /* return the result */
+}
+
+/**
+ * @brief     set the output stage
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] stage output stage
+ * @return    status code
+ *            - 0 success
+ *            - 1 set output stage failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t as5600_set_output_stage(as5600_handle_t *handle, as5600_output_stage_t stage)
+{
+    return a_as5600_field_set_one(handle, AS5600_FIELD_OUTPUT_STAGE, (uint16_t)stage,
+                                  "as5600: get conf failed.\n",
+                                  "as5600: set conf failed.\n");        /* set the field */
+}
+
+/**
+ * @brief      get the output stage
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *stage pointer to an output stage buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get output stage failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_output_stage(as5600_handle_t *handle, as5600_output_stage_t *stage)
+{
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_OUTPUT_STAGE, &value,
+                                 "as5600: get conf failed.\n");        /* get the field */
+    if (res == 0)                                                      /* check the result */
+    {
+        *stage = (as5600_output_stage_t)value;                         /* set the value */
+    }
+
+    return res;                                                        /* return the result */
+}
+
+/**
+ * @brief     set the hysteresis
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] hysteresis input hysteresis
+ * @return    status code
+ *            - 0 success
+ *            - 1 set hysteresis failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t as5600_set_hysteresis(as5600_handle_t *handle, as5600_hysteresis_t hysteresis)
+{
+    return a_as5600_field_set_one(handle, AS5600_FIELD_HYSTERESIS, (uint16_t)hysteresis,
+                                  "as5600: get conf failed.\n",
+                                  "as5600: set conf failed.\n");        /* set the field */
+}
+
+/**
+ * @brief      get the hysteresis
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *hysteresis pointer to a hysteresis buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get hysteresis failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_hysteresis(as5600_handle_t *handle, as5600_hysteresis_t *hysteresis)
+{
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_HYSTERESIS, &value,
+                                 "as5600: get conf failed.\n");        /* get the field */
+    if (res == 0)                                                      /* check the result */
+    {
+        *hysteresis = (as5600_hysteresis_t)value;                      /* set the value */
+    }
+
+    return res;                                                        /* return the result */
+}
+
+/**
+ * @brief     set the power mode
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] mode power mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set power mode failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t as5600_set_power_mode(as5600_handle_t *handle, as5600_power_mode_t mode)
+{
+    return a_as5600_field_set_one(handle, AS5600_FIELD_POWER_MODE, (uint16_t)mode,
+                                  "as5600: get conf failed.\n",
+                                  "as5600: set conf failed.\n");        /* set the field */
+}
+
+/**
+ * @brief      get the power mode
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *mode pointer to a power mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get power mode failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_power_mode(as5600_handle_t *handle, as5600_power_mode_t *mode)
+{
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_POWER_MODE, &value,
+                                 "as5600: get conf failed.\n");        /* get the field */
+    if (res == 0)                                                      /* check the result */
+    {
+        *mode = (as5600_power_mode_t)value;                            /* set the value */
+    }
+
+    return res;                                                        /* return the result */
+}
+
+/**
+ * @brief      get the raw angle
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *ang pointer to an ang buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get raw angle failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_raw_angle(as5600_handle_t *handle, uint16_t *ang)
+{
+    uint8_t buf[2];
+
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_GET_RAW_ANGLE);               /* set the stats api */
+    if (a_as5600_verify_read(handle, AS5600_REG_RAW_ANGLE_H, buf, 2) != 0)     /* read conf */
+    {
+        handle->debug_print("as5600: get raw angle failed.\n");                /* get raw angle failed */
+
+        return 1;                                                              /* return error */
+    }
+    else
+    {
+        a_as5600_sample_stamp(handle, 1);                                      /* stamp the sample */
+        *ang = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];                /* set the angle */
+        *ang = a_as5600_raw_adjust(handle, *ang);                              /* apply the software zero */
+
+        return 0;                                                              /* success return 0 */
+    }
+}
+
+/**
+ * @brief      get the angle
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *ang pointer to an ang buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get angle failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_angle(as5600_handle_t *handle, uint16_t *ang)
+{
+    uint8_t buf[2];
+
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_GET_ANGLE);               /* set the stats api */
+    if (a_as5600_verify_read(handle, AS5600_REG_ANGLE_H, buf, 2) != 0)     /* read conf */
+    {
+        handle->debug_print("as5600: get angle failed.\n");                /* get angle failed */
+
+        return 1;                                                          /* return error */
+    }
+    else
+    {
+        a_as5600_sample_stamp(handle, 1);                                  /* stamp the sample */
+        *ang = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];            /* set the angle */
+
+        return 0;                                                          /* success return 0 */
+    }
+}
+
+/**
+ * @brief      get the status
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *status pointer to a status buffer
  * @return     status code
  *             - 0 success
- *             - 1 read failed
+ *             - 1 get status failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
  * @note       none
  */
-static uint8_t a_as5600_iic_read(as5600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+uint8_t as5600_get_status(as5600_handle_t *handle, uint8_t *status)
 {
-    if (handle->iic_read(AS5600_ADDRESS, reg, data, len) != 0)        /* read the register */
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_STATUS, &value,
+                                 "as5600: get status failed.\n");        /* get the field */
+    if (res == 0)                                                        /* check the result */
     {
-        return 1;                                                     /* return error */
+        *status = (uint8_t)value;                                        /* set the value */
     }
-    else
+
+    return res;                                                          /* return the result */
+}
+
+/**
+ * @brief      get the automatic gain control
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *agc pointer to an agc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get agc failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_agc(as5600_handle_t *handle, uint8_t *agc)
+{
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_AGC, &value,
+                                 "as5600: get agc failed.\n");        /* get the field */
+    if (res == 0)                                                     /* check the result */
     {
-        return 0;                                                     /* success return 0 */
+        *agc = (uint8_t)value;                                        /* set the value */
     }
+
+    return res;                                                       /* return the result */
 }
 
 /**
- * @brief     write bytes
- * @param[in] *handle pointer to an as5600 handle structure
- * @param[in] reg iic register address
- * @param[in] *data pointer to a data buffer
- * @param[in] len data length
- * @return    status code
- *            - 0 success
- *            - 1 write failed
- * @note      none
+ * @brief      get the magnitude
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *magnitude pointer to a magnitude buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get magnitude failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-static uint8_t a_as5600_iic_write(as5600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+uint8_t as5600_get_magnitude(as5600_handle_t *handle, uint16_t *magnitude)
+{
+    uint8_t res;
+    uint16_t value;
+
+    res = a_as5600_field_get_one(handle, AS5600_FIELD_MAGNITUDE, &value,
+                                 "as5600: get magnitude failed.\n");        /* get the field */
+    if (res == 0)                                                           /* check the result */
+    {
+        *magnitude = value;                                                 /* set the value */
+    }
+
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief      read the status, raw angle, angle, agc and magnitude in one snapshot
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  diagnostic bool value, read the agc and magnitude or not
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read snapshot failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       status, raw angle and angle are read by one burst from 0x0B to 0x0F,
+ *             agc and magnitude are read by a second burst from 0x1A to 0x1C only when diagnostic is true,
+ *             otherwise agc and magnitude are set to 0
+ */
+uint8_t as5600_read_snapshot(as5600_handle_t *handle, as5600_bool_t diagnostic, as5600_snapshot_t *snapshot)
 {
-    if (handle->iic_write(AS5600_ADDRESS, reg, data, len) != 0)       /* write the register */
+    uint8_t buf[5];
+
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_READ_SNAPSHOT);                 /* set the stats api */
+    if (a_as5600_verify_read(handle, AS5600_REG_STATUS, buf, 5) != 0)            /* read status to angle */
     {
-        return 1;                                                     /* return error */
+        handle->debug_print("as5600: read snapshot failed.\n");                  /* read snapshot failed */
+
+        return 1;                                                                /* return error */
+    }
+    a_as5600_sample_stamp(handle, 1);                                            /* stamp the sample */
+    snapshot->status = buf[0];                                                   /* set the status */
+    snapshot->raw_angle = (uint16_t)(((buf[1] >> 0) & 0xF) << 8) | buf[2];       /* set the raw angle */
+    snapshot->raw_angle = a_as5600_raw_adjust(handle, snapshot->raw_angle);      /* apply the software zero */
+    snapshot->angle = (uint16_t)(((buf[3] >> 0) & 0xF) << 8) | buf[4];           /* set the angle */
+    if (diagnostic == AS5600_BOOL_TRUE)                                          /* if read the diagnostic */
+    {
+        if (a_as5600_verify_read(handle, AS5600_REG_AGC, buf, 3) != 0)           /* read agc and magnitude */
+        {
+            handle->debug_print("as5600: read snapshot failed.\n");              /* read snapshot failed */
+
+            return 1;                                                            /* return error */
+        }
+        snapshot->agc = buf[0];                                                  /* set the agc */
+        snapshot->magnitude = (uint16_t)(((buf[1] >> 0) & 0xF) << 8) | buf[2];   /* set the magnitude */
     }
     else
     {
-        return 0;                                                     /* success return 0 */
+        snapshot->agc = 0;                                                       /* clear the agc */
+        snapshot->magnitude = 0;                                                 /* clear the magnitude */
     }
+
+    return 0;                                                                    /* success return 0 */
 }
 
 /**
- * @brief     initialize the chip
+ * @brief     start the poll read
  * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] reg poll register
  * @return    status code
  *            - 0 success
- *            - 1 iic initialization failed
+ *            - 1 start poll read failed
  *            - 2 handle is NULL
- *            - 3 linked functions is NULL
- * @note      none
+ *            - 3 handle is not initialized
+ *            - 4 iic_read_cmd is null
+ * @note      the chip keeps the address pointer at the high byte of the raw angle, angle and magnitude registers,
+ *            so after the pointer is set once every poll read is a read only transfer without the register address
  */
-uint8_t as5600_init(as5600_handle_t *handle)
+uint8_t as5600_start_poll_read(as5600_handle_t *handle, as5600_poll_register_t reg)
 {
-    if (handle == NULL)                                              /* check handle */
+    uint8_t buf[2];
+
+    if (handle == NULL)                                                             /* check handle */
     {
-        return 2;                                                    /* return error */
+        return 2;                                                                   /* return error */
     }
-    if (handle->debug_print == NULL)                                 /* check debug_print */
+    if (handle->inited != 1)                                                        /* check handle initialization */
     {
-        return 3;                                                    /* return error */
+        return 3;                                                                   /* return error */
     }
-    if (handle->iic_init == NULL)                                    /* check iic_init */
+    if ((handle->iic_read_cmd == NULL) && (handle->iic_read_cmd_ex == NULL))        /* check iic_read_cmd */
     {
-        handle->debug_print("as5600: iic_init is null.\n");          /* iic_init is null */
+        handle->debug_print("as5600: iic_read_cmd is null.\n");                     /* iic_read_cmd is null */
 
-        return 3;                                                    /* return error */
+        return 4;                                                                   /* return error */
     }
-    if (handle->iic_deinit == NULL)                                  /* check iic_init */
+
+    handle->poll_enable = 0;                                                        /* stop the last poll read */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_REGISTER);                         /* set the stats api */
+    if (a_as5600_iic_read(handle, (uint8_t)reg, buf, 2) != 0)                       /* set the address pointer */
     {
-        handle->debug_print("as5600: iic_deinit is null.\n");        /* iic_deinit is null */
+        handle->debug_print("as5600: start poll read failed.\n");                   /* start poll read failed */
 
-        return 3;                                                    /* return error */
+        return 1;                                                                   /* return error */
     }
-    if (handle->iic_read == NULL)                                    /* check iic_read */
-    {
-        handle->debug_print("as5600: iic_read is null.\n");          /* iic_read is null */
+    handle->poll_reg = (uint8_t)reg;                                                /* save the poll register */
+    handle->poll_ready = 1;                                                         /* address pointer is ready */
+    handle->poll_enable = 1;                                                        /* enable the poll read */
 
-        return 3;                                                    /* return error */
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      poll read the register
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *data pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 poll read is not started
+ * @note       any other register access moves the address pointer and the next poll read sets it again,
+ *             with the verification enabled a suspicious read is repeated once with the register address
+ */
+uint8_t as5600_poll_read(as5600_handle_t *handle, uint16_t *data)
+{
+    uint8_t res;
+    uint8_t buf[2];
+
+    if (handle == NULL)                                                         /* check handle */
+    {
+        return 2;                                                               /* return error */
     }
-    if (handle->iic_write == NULL)                                   /* check iic_write */
+    if (handle->inited != 1)                                                    /* check handle initialization */
     {
-        handle->debug_print("as5600: iic_write is null.\n");         /* iic_write is null */
-
-        return 3;                                                    /* return error */
+        return 3;                                                               /* return error */
     }
-    if (handle->delay_ms == NULL)                                    /* check delay_ms */
+    if (handle->poll_enable != 1)                                               /* check poll read */
     {
-        handle->debug_print("as5600: delay_ms is null.\n");          /* delay_ms is null */
+        handle->debug_print("as5600: poll read is not started.\n");             /* poll read is not started */
 
-        return 3;                                                    /* return error */
+        return 4;                                                               /* return error */
     }
 
-    if (handle->iic_init() != 0)                                     /* iic init */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_POLL_READ);                    /* set the stats api */
+    if (handle->poll_ready == 1)                                                /* if the pointer is ready */
+    {
+        a_as5600_xfer_begin(handle);                                            /* take the start time */
+        if (handle->iic_read_cmd_ex != NULL)                                    /* if the user data read is linked */
+        {
+            res = handle->iic_read_cmd_ex(handle->user_data, AS5600_ADDRESS,
+                                          buf, 2);                              /* read without address */
+        }
+        else
+        {
+            res = handle->iic_read_cmd(AS5600_ADDRESS, buf, 2);                 /* read without address */
+        }
+        a_as5600_xfer_end(handle);                                              /* take the end time */
+        AS5600_STATS_END(handle, 2, res);                                       /* stats end */
+    }
+    else
+    {
+        res = a_as5600_iic_read(handle, handle->poll_reg, buf, 2);              /* read with address */
+    }
+    if (res == 0)                                                               /* if the read is ok */
     {
-        handle->debug_print("as5600: iic init failed.\n");           /* iic init failed */
+        res = a_as5600_verify_sample(handle, handle->poll_reg, buf, 2);         /* verify the read */
+    }
+    if (res != 0)                                                               /* check the result */
+    {
+        handle->poll_ready = 0;                                                 /* pointer is unknown */
+        handle->debug_print("as5600: poll read failed.\n");                     /* poll read failed */
 
-        return 1;                                                    /* return error */
+        return 1;                                                               /* return error */
+    }
+    handle->poll_ready = 1;                                                     /* address pointer is ready */
+    a_as5600_sample_stamp(handle, 1);                                           /* stamp the sample */
+    *data = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];                    /* set the data */
+    if (handle->poll_reg == AS5600_REG_RAW_ANGLE_H)                             /* if the raw angle */
+    {
+        *data = a_as5600_raw_adjust(handle, *data);                             /* apply the software zero */
     }
-    handle->inited = 1;                                              /* flag finish initialization */
 
-    return 0;                                                        /* success return 0 */
+    return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief     close the chip
+ * @brief     stop the poll read
  * @param[in] *handle pointer to an as5600 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 iic deinit failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t as5600_deinit(as5600_handle_t *handle)
+uint8_t as5600_stop_poll_read(as5600_handle_t *handle)
 {
-    if (handle == NULL)                                             /* check handle */
+    if (handle == NULL)                 /* check handle */
     {
-        return 2;                                                   /* return error */
+        return 2;                       /* return error */
     }
-    if (handle->inited != 1)                                        /* check handle initialization */
+    if (handle->inited != 1)            /* check handle initialization */
     {
-        return 3;                                                   /* return error */
+        return 3;                       /* return error */
+    }
+
+    handle->poll_enable = 0;            /* disable the poll read */
+    handle->poll_ready = 0;             /* clear the ready flag */
+
+    return 0;                           /* success return 0 */
+}
+
+/**
+ * @brief     start an async raw angle read
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 iic_read_async is null
+ *            - 5 async read is busy
+ * @note      the call returns once the transfer is queued, the result is taken by as5600_read_poll,
+ *            no other api may use the handle until the transfer completes
+ */
+uint8_t as5600_read_start(as5600_handle_t *handle)
+{
+    uint8_t res;
+
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
     }
+    if (handle->inited != 1)                                                        /* check handle initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+    if (handle->iic_read_async == NULL)                                             /* check iic_read_async */
+    {
+        handle->debug_print("as5600: iic_read_async is null.\n");                   /* iic_read_async is null */
 
-    if (handle->iic_deinit() != 0)                                  /* iic deinit */
+        return 4;                                                                   /* return error */
+    }
+    if (handle->async_state == AS5600_ASYNC_STATE_BUSY)                             /* check the state */
     {
-        handle->debug_print("as5600: iic deinit failed.\n");        /* iic deinit failed */
+        handle->debug_print("as5600: async read is busy.\n");                       /* async read is busy */
 
-        return 1;                                                   /* return error */
+        return 5;                                                                   /* return error */
     }
-    handle->inited = 0;                                             /* flag close */
 
-    return 0;                                                       /* success return 0 */
+    handle->poll_ready = 0;                                                         /* address pointer is moved */
+    handle->async_state = AS5600_ASYNC_STATE_BUSY;                                  /* transfer in flight */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_READ_ASYNC);                       /* set the stats api */
+    a_as5600_xfer_begin(handle);                                                    /* take the start time */
+    res = handle->iic_read_async(handle->user_data, AS5600_ADDRESS,
+                                 AS5600_REG_RAW_ANGLE_H, handle->async_buf, 2,
+                                 a_as5600_async_done, handle);                      /* start the read */
+    if (res != 0)                                                                   /* check the result */
+    {
+        a_as5600_xfer_end(handle);                                                  /* take the end time */
+        AS5600_STATS_END(handle, 2, res);                                           /* stats end */
+        handle->async_state = AS5600_ASYNC_STATE_IDLE;                              /* no transfer */
+        handle->debug_print("as5600: read start failed.\n");                        /* read start failed */
+
+        return 1;                                                                   /* return error */
+    }
+
+    return 0;                                                                       /* success return 0 */
 }
 
 /**
- * @brief      read the magnetic angle
+ * @brief      poll an async raw angle read
  * @param[in]  *handle pointer to an as5600 handle structure
  * @param[out] *angle_raw pointer to a raw angle buffer
- * @param[out] *deg pointer to a converted angle buffer
  * @return     status code
  *             - 0 success
- *             - 1 read failed
+ *             - 1 read poll failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ *             - 4 transfer is in flight
+ *             - 5 async read is not started
+ * @note       never blocks, a completed transfer is taken once and the state goes back to idle,
+ *             the sample is stamped like a blocking read, with the verification enabled a suspicious
+ *             sample is counted and fails with 1 instead of being read again
  */
-uint8_t as5600_read(as5600_handle_t *handle, uint16_t *angle_raw, float *deg)
+uint8_t as5600_read_poll(as5600_handle_t *handle, uint16_t *angle_raw)
 {
-    uint8_t buf[2];
+    uint8_t res;
+    uint8_t state;
 
-    if (handle == NULL)                                                        /* check handle */
+    if (handle == NULL)                                                                         /* check handle */
     {
-        return 2;                                                              /* return error */
+        return 2;                                                                               /* return error */
     }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    if (handle->inited != 1)                                                                    /* check handle initialization */
     {
-        return 3;                                                              /* return error */
+        return 3;                                                                               /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_RAW_ANGLE_H, buf, 2) != 0)        /* read conf */
+    state = AS5600_LOAD_ACQUIRE(&handle->async_state);                                          /* get the state before the data */
+    if (state == AS5600_ASYNC_STATE_BUSY)                                                       /* check busy */
     {
-        handle->debug_print("as5600: get raw angle failed.\n");                /* get raw angle failed */
+        return 4;                                                                               /* return busy */
+    }
+    if (state == AS5600_ASYNC_STATE_IDLE)                                                       /* check idle */
+    {
+        handle->debug_print("as5600: async read is not started.\n");                            /* async read is not started */
 
-        return 1;                                                              /* return error */
+        return 5;                                                                               /* return error */
     }
-    else
+    handle->async_state = AS5600_ASYNC_STATE_IDLE;                                              /* take the result */
+    if (state == AS5600_ASYNC_STATE_FAILED)                                                     /* check the result */
     {
-        *angle_raw = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];          /* set the raw angle */
-        *deg = (float)(*angle_raw ) * (360.0f / 4096.0f);                      /* convert the raw data to the real data */
+        handle->debug_print("as5600: read poll failed.\n");                                     /* read poll failed */
 
-        return 0;                                                              /* success return 0 */
+        return 1;                                                                               /* return error */
+    }
+    if (handle->verify_enable == 1)                                                             /* check the verify */
+    {
+        res = a_as5600_verify_check(handle, AS5600_REG_RAW_ANGLE_H,
+                                    handle->async_buf, 2, AS5600_BOOL_TRUE);                    /* check without a blocking repeat */
+        if (res != 0)                                                                           /* check the result */
+        {
+            if (res == 1)                                                                       /* if reserved bits */
+            {
+                handle->verify_reserved++;                                                      /* count the reserved bits event */
+            }
+            else
+            {
+                handle->verify_jump++;                                                          /* count the jump event */
+            }
+            handle->debug_print("as5600: read poll failed.\n");                                 /* read poll failed */
+
+            return 1;                                                                           /* return error */
+        }
     }
+    a_as5600_sample_stamp(handle, 1);                                                           /* stamp the sample */
+    *angle_raw = (uint16_t)(((handle->async_buf[0] >> 0) & 0xF) << 8) | handle->async_buf[1];   /* set the raw angle */
+    *angle_raw = a_as5600_raw_adjust(handle, *angle_raw);                                       /* apply the software zero */
+
+    return 0;                                                                                   /* success return 0 */
 }
 
 /**
- * @brief      convert the angle to the register raw data
+ * @brief      read the raw angle n times back to back
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[in]  deg angle
- * @param[out] *reg pointer to a register raw buffer
+ * @param[out] *raw pointer to a raw angle array
+ * @param[in]  n sample number
  * @return     status code
  *             - 0 success
+ *             - 1 read burst failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ *             - 4 iic_read_repeat is null
+ * @note       the address pointer is set once and then every sample is a read only transfer,
+ *             the samples are read in place into the raw array, with the verification enabled
+ *             every sample is checked and a suspicious one is read again once by itself
  */
-uint8_t as5600_angle_convert_to_register(as5600_handle_t *handle, float deg, uint16_t *reg)
+uint8_t as5600_read_burst(as5600_handle_t *handle, uint16_t *raw, size_t n)
 {
-    if (handle == NULL)                                  /* check handle */
+    uint8_t res;
+    size_t i;
+    size_t num;
+    uint8_t *buf;
+
+    if (handle == NULL)                                                                  /* check handle */
     {
-        return 2;                                        /* return error */
+        return 2;                                                                        /* return error */
     }
-    if (handle->inited != 1)                             /* check handle initialization */
+    if (handle->inited != 1)                                                             /* check handle initialization */
     {
-        return 3;                                        /* return error */
+        return 3;                                                                        /* return error */
     }
+    if (handle->iic_read_repeat == NULL)                                                 /* check iic_read_repeat */
+    {
+        handle->debug_print("as5600: iic_read_repeat is null.\n");                       /* iic_read_repeat is null */
 
-    *reg = (uint16_t)(deg / (360.0f / 4096.0f));         /* convert real data to register data */
+        return 4;                                                                        /* return error */
+    }
 
-    return 0;                                            /* success return 0 */
+    handle->poll_ready = 0;                                                              /* address pointer is moved */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_READ_BURST);                            /* set the stats api */
+    for (i = 0; i < n; i += num)                                                         /* read all */
+    {
+        num = ((n - i) > 0xFFFF) ? 0xFFFF : (n - i);                                     /* get the chunk size */
+        a_as5600_xfer_begin(handle);                                                     /* take the start time */
+        res = handle->iic_read_repeat(handle->user_data, AS5600_ADDRESS,
+                                      AS5600_REG_RAW_ANGLE_H, (uint8_t *)&raw[i],
+                                      2, (uint16_t)num);                                 /* read the chunk */
+        a_as5600_xfer_end(handle);                                                       /* take the end time */
+        AS5600_STATS_END(handle, (uint32_t)(num * 2), res);                              /* stats end */
+        if (res != 0)                                                                    /* check the result */
+        {
+            handle->debug_print("as5600: read burst failed.\n");                         /* read burst failed */
+
+            return 1;                                                                    /* return error */
+        }
+    }
+    if (n != 0)                                                                          /* if any sample */
+    {
+        a_as5600_sample_stamp(handle, (uint32_t)num);                                    /* stamp the last sample */
+    }
+    for (i = 0; i < n; i++)                                                              /* convert in place */
+    {
+        buf = (uint8_t *)&raw[i];                                                        /* get the bytes */
+        if (a_as5600_verify_sample(handle, AS5600_REG_RAW_ANGLE_H, buf, 2) != 0)         /* verify the sample */
+        {
+            handle->debug_print("as5600: read burst failed.\n");                         /* read burst failed */
+
+            return 1;                                                                    /* return error */
+        }
+        raw[i] = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];                        /* set the raw angle */
+        raw[i] = a_as5600_raw_adjust(handle, raw[i]);                                    /* apply the software zero */
+    }
+
+    return 0;                                                                            /* success return 0 */
 }
 
 /**
- * @brief      convert the register raw data to the angle
+ * @brief     enable or disable the shadow cache
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the shadow cache is a write through copy of the zpos, mpos, mang and conf registers,
+ *            it is loaded by one burst read at the first access and then the setters only write and the getters don't access the bus
+ */
+uint8_t as5600_set_shadow_cache(as5600_handle_t *handle, as5600_bool_t enable)
+{
+    if (handle == NULL)                                /* check handle */
+    {
+        return 2;                                      /* return error */
+    }
+    if (handle->inited != 1)                           /* check handle initialization */
+    {
+        return 3;                                      /* return error */
+    }
+
+    handle->shadow_enable = (uint8_t)enable;           /* set the shadow enable */
+    handle->shadow_valid = 0;                          /* reload at the next access */
+
+    return 0;                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the shadow cache status
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[in]  reg register raw data
- * @param[out] *deg pointer to an angle buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t as5600_angle_convert_to_data(as5600_handle_t *handle, uint16_t reg, float *deg)
+uint8_t as5600_get_shadow_cache(as5600_handle_t *handle, as5600_bool_t *enable)
 {
-    if (handle == NULL)                              /* check handle */
+    if (handle == NULL)                                        /* check handle */
     {
-        return 2;                                    /* return error */
+        return 2;                                              /* return error */
     }
-    if (handle->inited != 1)                         /* check handle initialization */
+    if (handle->inited != 1)                                   /* check handle initialization */
     {
-        return 3;                                    /* return error */
+        return 3;                                              /* return error */
     }
 
-    *deg = (float)(reg) * (360.0f / 4096.0f);        /* convert raw data to real data */
+    *enable = (as5600_bool_t)(handle->shadow_enable);          /* get the shadow enable */
 
-    return 0;                                        /* success return 0 */
+    return 0;                                                  /* success return 0 */
 }
 
 /**
- * @brief     set the start position
+ * @brief     refresh the shadow cache
  * @param[in] *handle pointer to an as5600 handle structure
- * @param[in] pos start position
  * @return    status code
  *            - 0 success
- *            - 1 set start position failed
+ *            - 1 refresh shadow cache failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 pos is over 0xFFF
+ *            - 4 shadow cache is disabled
  * @note      none
  */
-uint8_t as5600_set_start_position(as5600_handle_t *handle, uint16_t pos)
+uint8_t as5600_shadow_cache_refresh(as5600_handle_t *handle)
 {
-    uint8_t buf[2];
-
-    if (handle == NULL)                                                     /* check handle */
+    if (handle == NULL)                                                             /* check handle */
     {
-        return 2;                                                           /* return error */
+        return 2;                                                                   /* return error */
     }
-    if (handle->inited != 1)                                                /* check handle initialization */
+    if (handle->inited != 1)                                                        /* check handle initialization */
     {
-        return 3;                                                           /* return error */
+        return 3;                                                                   /* return error */
     }
-    if (pos > 0xFFF)                                                        /* check the pos */
+    if (handle->shadow_enable != 1)                                                 /* check the shadow enable */
     {
-        handle->debug_print("as5600: pos is over 0xFFF.\n");                /* pos is over 0xFFF */
+        handle->debug_print("as5600: shadow cache is disabled.\n");                 /* shadow cache is disabled */
 
-        return 4;                                                           /* return error */
+        return 4;                                                                   /* return error */
     }
 
-    buf[0] = (pos >> 8) & 0x0F;                                             /* set high part */
-    buf[1] = (pos >> 0) & 0xFF;                                             /* set low part */
-    if (a_as5600_iic_write(handle, AS5600_REG_ZPOS_H, buf, 2) != 0)         /* write conf */
+    handle->shadow_valid = 0;                                                       /* invalidate the shadow cache */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_REGISTER);                         /* set the stats api */
+    if (a_as5600_iic_read(handle, AS5600_REG_ZPOS_H, handle->shadow, 8) != 0)       /* load the shadow cache */
     {
-        handle->debug_print("as5600: set start position failed.\n");        /* set start position failed */
+        handle->debug_print("as5600: refresh shadow cache failed.\n");              /* refresh shadow cache failed */
 
-        return 1;                                                           /* return error */
-    }
-    else
-    {
-        return 0;                                                           /* success return 0 */
+        return 1;                                                                   /* return error */
     }
+    handle->shadow_valid = 1;                                                       /* flag the shadow valid */
+
+    return 0;                                                                       /* success return 0 */
 }
 
 /**
- * @brief      get the start position
- * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *pos pointer to a start position buffer
- * @return     status code
- *             - 0 success
- *             - 1 get start position failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     invalidate the shadow cache
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it when the registers are changed outside the driver,
+ *            the next access reloads the shadow cache
  */
-uint8_t as5600_get_start_position(as5600_handle_t *handle, uint16_t *pos)
+uint8_t as5600_shadow_cache_invalidate(as5600_handle_t *handle)
 {
-    uint8_t buf[2];
-
-    if (handle == NULL)                                                     /* check handle */
+    if (handle == NULL)                 /* check handle */
     {
-        return 2;                                                           /* return error */
+        return 2;                       /* return error */
     }
-    if (handle->inited != 1)                                                /* check handle initialization */
+    if (handle->inited != 1)            /* check handle initialization */
     {
-        return 3;                                                           /* return error */
+        return 3;                       /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_ZPOS_H, buf, 2) != 0)          /* read conf */
-    {
-        handle->debug_print("as5600: get start position failed.\n");        /* get start position failed */
-
-        return 1;                                                           /* return error */
-    }
-    else
-    {
-        *pos = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];             /* set the position */
+    handle->shadow_valid = 0;           /* invalidate the shadow cache */
 
-        return 0;                                                           /* success return 0 */
-    }
+    return 0;                           /* success return 0 */
 }
 
 /**
- * @brief     set the stop position
+ * @brief     apply the whole configuration
  * @param[in] *handle pointer to an as5600 handle structure
- * @param[in] pos stop position
+ * @param[in] *config pointer to a config structure
+ * @param[in] diff bool value, only write the changed bytes or not
  * @return    status code
  *            - 0 success
- *            - 1 set stop position failed
+ *            - 1 apply config failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 pos is over 0xFFF
- * @note      none
+ *            - 4 position or angle is over 0xFFF
+ * @note      registers from 0x01 to 0x08 are written by one burst,
+ *            if diff is true the current registers are read first and only the span of the changed bytes is written,
+ *            the reserved bits 7:6 of conf high are read back and kept in both cases
  */
-uint8_t as5600_set_stop_position(as5600_handle_t *handle, uint16_t pos)
+uint8_t as5600_apply_config(as5600_handle_t *handle, const as5600_config_t *config, as5600_bool_t diff)
 {
-    uint8_t buf[2];
+    uint8_t res;
+    uint8_t i;
+    uint8_t start;
+    uint8_t stop;
+    uint8_t buf[8];
+    uint8_t prev[8];
 
-    if (handle == NULL)                                                     /* check handle */
+    if (handle == NULL)                                                                     /* check handle */
     {
-        return 2;                                                           /* return error */
+        return 2;                                                                           /* return error */
     }
-    if (handle->inited != 1)                                                /* check handle initialization */
+    if (handle->inited != 1)                                                                /* check handle initialization */
     {
-        return 3;                                                           /* return error */
+        return 3;                                                                           /* return error */
     }
-    if (pos > 0xFFF)                                                        /* check the pos */
+    if ((config->start_position > 0xFFF) ||                                                 /* check the start position */
+        (config->stop_position > 0xFFF) ||                                                  /* check the stop position */
+        (config->max_angle > 0xFFF))                                                        /* check the max angle */
     {
-        handle->debug_print("as5600: pos is over 0xFFF.\n");                /* pos is over 0xFFF */
+        handle->debug_print("as5600: position or angle is over 0xFFF.\n");                  /* position or angle is over 0xFFF */
 
-        return 4;                                                           /* return error */
+        return 4;                                                                           /* return error */
     }
 
-    buf[0] = (pos >> 8) & 0x0F;                                             /* set high part */
-    buf[1] = (pos >> 0) & 0xFF;                                             /* set low part */
-    if (a_as5600_iic_write(handle, AS5600_REG_MPOS_H, buf, 2) != 0)         /* write conf */
+    buf[0] = (config->start_position >> 8) & 0x0F;                                          /* set start position high part */
+    buf[1] = (config->start_position >> 0) & 0xFF;                                          /* set start position low part */
+    buf[2] = (config->stop_position >> 8) & 0x0F;                                           /* set stop position high part */
+    buf[3] = (config->stop_position >> 0) & 0xFF;                                           /* set stop position low part */
+    buf[4] = (config->max_angle >> 8) & 0x0F;                                               /* set max angle high part */
+    buf[5] = (config->max_angle >> 0) & 0xFF;                                               /* set max angle low part */
+    buf[6] = (uint8_t)(((config->watch_dog & 0x1) << 5) |                                   /* set the watch dog */
+                       ((config->fast_filter_threshold & 0x7) << 2) |                       /* set the fast filter threshold */
+                       ((config->slow_filter & 0x3) << 0));                                 /* set the slow filter */
+    buf[7] = (uint8_t)(((config->pwm_frequency & 0x3) << 6) |                               /* set the pwm frequency */
+                       ((config->output_stage & 0x3) << 4) |                                /* set the output stage */
+                       ((config->hysteresis & 0x3) << 2) |                                  /* set the hysteresis */
+                       ((config->power_mode & 0x3) << 0));                                  /* set the power mode */
+    start = 0;                                                                              /* write from zpos */
+    stop = 7;                                                                               /* write to conf */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_CONFIG);                                   /* set the stats api */
+    if (diff == AS5600_BOOL_TRUE)                                                           /* if only write the changed bytes */
     {
-        handle->debug_print("as5600: set stop position failed.\n");         /* set stop position failed */
-
-        return 1;                                                           /* return error */
+        res = a_as5600_shadow_read(handle, AS5600_REG_ZPOS_H, prev, 8);                     /* read the current config */
     }
     else
     {
-        return 0;                                                           /* success return 0 */
+        res = a_as5600_shadow_read(handle, AS5600_REG_CONF_H, &prev[6], 1);                 /* read the current conf high */
+    }
+    if (res != 0)                                                                           /* check the result */
+    {
+        handle->debug_print("as5600: get conf failed.\n");                                  /* get conf failed */
+
+        return 1;                                                                           /* return error */
+    }
+    buf[6] |= prev[6] & 0xC0;                                                               /* keep the reserved bits */
+    if (diff == AS5600_BOOL_TRUE)                                                           /* if only write the changed bytes */
+    {
+        while ((start < 8) && (buf[start] == prev[start]))                                  /* find the first changed byte */
+        {
+            start++;                                                                        /* next */
+        }
+        if (start == 8)                                                                     /* nothing changed */
+        {
+            return 0;                                                                       /* success return 0 */
+        }
+        while (buf[stop] == prev[stop])                                                     /* find the last changed byte */
+        {
+            stop--;                                                                         /* previous */
+        }
+    }
+    i = (uint8_t)(stop - start + 1);                                                        /* get the length */
+    if (a_as5600_iic_write(handle, (uint8_t)(AS5600_REG_ZPOS_H + start),
+                           &buf[start], i) != 0)                                            /* write the config */
+    {
+        handle->debug_print("as5600: apply config failed.\n");                              /* apply config failed */
+
+        return 1;                                                                           /* return error */
     }
+
+    return 0;                                                                               /* success return 0 */
 }
 
 /**
- * @brief      get the stop position
+ * @brief      get the whole configuration
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *pos pointer to a stop position buffer
+ * @param[out] *config pointer to a config structure
  * @return     status code
  *             - 0 success
- *             - 1 get stop position failed
+ *             - 1 get config failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       registers from 0x01 to 0x08 are read by one burst
  */
-uint8_t as5600_get_stop_position(as5600_handle_t *handle, uint16_t *pos)
+uint8_t as5600_get_config(as5600_handle_t *handle, as5600_config_t *config)
 {
-    uint8_t buf[2];
+    uint8_t buf[8];
 
-    if (handle == NULL)                                                     /* check handle */
+    if (handle == NULL)                                                                          /* check handle */
     {
-        return 2;                                                           /* return error */
+        return 2;                                                                                /* return error */
     }
-    if (handle->inited != 1)                                                /* check handle initialization */
+    if (handle->inited != 1)                                                                     /* check handle initialization */
     {
-        return 3;                                                           /* return error */
+        return 3;                                                                                /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_MPOS_H, buf, 2) != 0)          /* read conf */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_CONFIG);                                        /* set the stats api */
+    if (a_as5600_shadow_read(handle, AS5600_REG_ZPOS_H, buf, 8) != 0)                            /* read the config */
     {
-        handle->debug_print("as5600: get stop position failed.\n");         /* get stop position failed */
+        handle->debug_print("as5600: get config failed.\n");                                     /* get config failed */
 
-        return 1;                                                           /* return error */
+        return 1;                                                                                /* return error */
     }
-    else
-    {
-        *pos = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];             /* set the position */
+    config->start_position = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];                   /* set the start position */
+    config->stop_position = (uint16_t)(((buf[2] >> 0) & 0xF) << 8) | buf[3];                    /* set the stop position */
+    config->max_angle = (uint16_t)(((buf[4] >> 0) & 0xF) << 8) | buf[5];                        /* set the max angle */
+    config->watch_dog = (as5600_bool_t)((buf[6] >> 5) & 0x1);                                    /* set the watch dog */
+    config->fast_filter_threshold = (as5600_fast_filter_threshold_t)((buf[6] >> 2) & 0x7);       /* set the fast filter threshold */
+    config->slow_filter = (as5600_slow_filter_t)((buf[6] >> 0) & 0x3);                           /* set the slow filter */
+    config->pwm_frequency = (as5600_pwm_frequency_t)((buf[7] >> 6) & 0x3);                       /* set the pwm frequency */
+    config->output_stage = (as5600_output_stage_t)((buf[7] >> 4) & 0x3);                         /* set the output stage */
+    config->hysteresis = (as5600_hysteresis_t)((buf[7] >> 2) & 0x3);                             /* set the hysteresis */
+    config->power_mode = (as5600_power_mode_t)((buf[7] >> 0) & 0x3);                             /* set the power mode */
 
-        return 0;                                                           /* success return 0 */
-    }
+    return 0;                                                                                    /* success return 0 */
 }
 
 /**
- * @brief     set the max angle
+ * @brief     set one register field
  * @param[in] *handle pointer to an as5600 handle structure
- * @param[in] ang max angle
+ * @param[in] field register field
+ * @param[in] value field value
  * @return    status code
  *            - 0 success
- *            - 1 set max angle failed
+ *            - 1 set field failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 ang is over 0xFFF
- * @note      none
+ *            - 4 field is invalid
+ *            - 5 field is read only
+ *            - 6 value is over the field width
+ * @note      the other fields in the same register are kept
  */
-uint8_t as5600_set_max_angle(as5600_handle_t *handle, uint16_t ang)
+uint8_t as5600_field_set(as5600_handle_t *handle, as5600_field_t field, uint16_t value)
 {
-    uint8_t buf[2];
+    uint8_t res;
+    as5600_field_value_t item;
 
-    if (handle == NULL)                                                     /* check handle */
-    {
-        return 2;                                                           /* return error */
-    }
-    if (handle->inited != 1)                                                /* check handle initialization */
+    if (handle == NULL)                                                 /* check handle */
     {
-        return 3;                                                           /* return error */
+        return 2;                                                       /* return error */
     }
-    if (ang > 0xFFF)                                                        /* check the ang */
+    if (handle->inited != 1)                                            /* check handle initialization */
     {
-        handle->debug_print("as5600: ang is over 0xFFF.\n");                /* ang is over 0xFFF */
-
-        return 4;                                                           /* return error */
+        return 3;                                                       /* return error */
     }
 
-    buf[0] = (ang >> 8) & 0x0F;                                             /* set high part */
-    buf[1] = (ang >> 0) & 0xFF;                                             /* set low part */
-    if (a_as5600_iic_write(handle, AS5600_REG_MANG_H, buf, 2) != 0)         /* write conf */
+    item.field = field;                                                 /* set the field */
+    item.value = value;                                                 /* set the value */
+    res = a_as5600_field_check(handle, &item, AS5600_BOOL_TRUE);        /* check the field */
+    if (res != 0)                                                       /* check the result */
     {
-        handle->debug_print("as5600: set max angle failed.\n");             /* set max angle failed */
-
-        return 1;                                                           /* return error */
+        return res;                                                     /* return error */
     }
-    else
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_FIELD_SET);            /* set the stats api */
+    if (a_as5600_field_write(handle, &item, 1) != 0)                    /* write the field */
     {
-        return 0;                                                           /* success return 0 */
+        handle->debug_print("as5600: set field failed.\n");             /* set field failed */
+
+        return 1;                                                       /* return error */
     }
+
+    return 0;                                                           /* success return 0 */
 }
 
 /**
- * @brief      get the max angle
+ * @brief      get one register field
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *ang pointer to a max angle buffer
+ * @param[in]  field register field
+ * @param[out] *value pointer to a field value buffer
  * @return     status code
  *             - 0 success
- *             - 1 get max angle failed
+ *             - 1 get field failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ *             - 4 field is invalid
+ * @note       the raw angle field gets the software zero like as5600_get_raw_angle
  */
-uint8_t as5600_get_max_angle(as5600_handle_t *handle, uint16_t *ang)
+uint8_t as5600_field_get(as5600_handle_t *handle, as5600_field_t field, uint16_t *value)
 {
-    uint8_t buf[2];
+    uint8_t res;
+    as5600_field_value_t item;
 
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                                  /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                                        /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                             /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                                        /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_MANG_H, buf, 2) != 0)        /* read conf */
+    item.field = field;                                                  /* set the field */
+    item.value = 0;                                                      /* init 0 */
+    res = a_as5600_field_check(handle, &item, AS5600_BOOL_FALSE);        /* check the field */
+    if (res != 0)                                                        /* check the result */
     {
-        handle->debug_print("as5600: get max angle failed.\n");           /* get max angle failed */
-
-        return 1;                                                         /* return error */
+        return res;                                                      /* return error */
     }
-    else
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_FIELD_GET);             /* set the stats api */
+    if (a_as5600_field_read(handle, &item, 1) != 0)                      /* read the field */
     {
-        *ang = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];           /* set the position */
+        handle->debug_print("as5600: get field failed.\n");              /* get field failed */
 
-        return 0;                                                         /* success return 0 */
+        return 1;                                                        /* return error */
     }
+    *value = item.value;                                                 /* set the value */
+
+    return 0;                                                            /* success return 0 */
 }
 
 /**
- * @brief     enable or disable the watch dog
+ * @brief     set several register fields in one transaction
  * @param[in] *handle pointer to an as5600 handle structure
- * @param[in] enable bool value
+ * @param[in] *list pointer to a field value list
+ * @param[in] num list length
  * @return    status code
  *            - 0 success
- *            - 1 set watchdog failed
+ *            - 1 set fields failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 field is invalid
+ *            - 5 field is read only
+ *            - 6 value is over the field width
+ * @note      the span of the touched registers is read once if a register is only partly covered and written by one burst,
+ *            a later entry of the same field wins and nothing is written if one entry is rejected
  */
-uint8_t as5600_set_watch_dog(as5600_handle_t *handle, as5600_bool_t enable)
+uint8_t as5600_field_set_multiple(as5600_handle_t *handle, const as5600_field_value_t *list, uint8_t num)
 {
-    uint8_t prev;
+    uint8_t i;
+    uint8_t res;
 
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                                              /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_H, &prev, 1) != 0)      /* read conf */
+    for (i = 0; i < num; i++)                                                  /* check all fields */
     {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
-
-        return 1;                                                         /* return error */
+        res = a_as5600_field_check(handle, &list[i], AS5600_BOOL_TRUE);        /* check the field */
+        if (res != 0)                                                          /* check the result */
+        {
+            return res;                                                        /* return error */
+        }
     }
-    prev &= ~(1 << 5);                                                    /* clear the settings */
-    prev |= enable << 5;                                                  /* set the bool */
-    if (a_as5600_iic_write(handle, AS5600_REG_CONF_H, &prev, 1) != 0)     /* write conf */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_FIELD_SET);                   /* set the stats api */
+    if (a_as5600_field_write(handle, list, num) != 0)                          /* write all fields */
     {
-        handle->debug_print("as5600: set conf failed.\n");                /* set conf failed */
+        handle->debug_print("as5600: set fields failed.\n");                   /* set fields failed */
 
-        return 1;                                                         /* return error */
+        return 1;                                                              /* return error */
     }
 
-    return 0;                                                             /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief      get the watch dog status
- * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *enable pointer to a bool value buffer
- * @return     status code
- *             - 0 success
- *             - 1 get watchdog failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief         get several register fields
+ * @param[in]     *handle pointer to an as5600 handle structure
+ * @param[in,out] *list pointer to a field value list
+ * @param[in]     num list length
+ * @return        status code
+ *                - 0 success
+ *                - 1 get fields failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 field is invalid
+ * @note          the fields are grouped by the config, output and magnet register blocks,
+ *                each touched block is read by one burst and the raw angle field gets the software zero
  */
-uint8_t as5600_get_watch_dog(as5600_handle_t *handle, as5600_bool_t *enable)
+uint8_t as5600_field_get_multiple(as5600_handle_t *handle, as5600_field_value_t *list, uint8_t num)
 {
-    uint8_t prev;
+    uint8_t i;
+    uint8_t res;
 
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                                         /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                                               /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                                    /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                                               /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_H, &prev, 1) != 0)      /* read conf */
+    for (i = 0; i < num; i++)                                                   /* check all fields */
+    {
+        res = a_as5600_field_check(handle, &list[i], AS5600_BOOL_FALSE);        /* check the field */
+        if (res != 0)                                                           /* check the result */
+        {
+            return res;                                                         /* return error */
+        }
+    }
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_FIELD_GET);                    /* set the stats api */
+    if (a_as5600_field_read(handle, list, num) != 0)                            /* read all fields */
     {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
+        handle->debug_print("as5600: get fields failed.\n");                    /* get fields failed */
 
-        return 1;                                                         /* return error */
+        return 1;                                                               /* return error */
     }
-    *enable = (as5600_bool_t)((prev >> 5) & 0x1);                         /* get the bool */
 
-    return 0;                                                             /* success return 0 */
+    return 0;                                                                   /* success return 0 */
 }
 
 /**
- * @brief     set the fast filter threshold
+ * @brief     initialize the multi turn tracker
  * @param[in] *handle pointer to an as5600 handle structure
- * @param[in] threshold fast filter threshold
+ * @param[in] max_step max raw angle step between two samples
  * @return    status code
  *            - 0 success
- *            - 1 set fast filter threshold failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 max step is invalid
+ * @note      1 <= max_step <= 2047,
+ *            a larger step between two samples is flagged as aliasing,
+ *            the position and the alias counter are cleared
  */
-uint8_t as5600_set_fast_filter_threshold(as5600_handle_t *handle, as5600_fast_filter_threshold_t threshold)
+uint8_t as5600_multi_turn_init(as5600_handle_t *handle, uint16_t max_step)
 {
-    uint8_t prev;
-
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                                  /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                                        /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                             /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                                        /* return error */
     }
-
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_H, &prev, 1) != 0)      /* read conf */
+    if ((max_step == 0) || (max_step > 2047))                            /* check the max step */
     {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
+        handle->debug_print("as5600: max step is invalid.\n");           /* max step is invalid */
 
-        return 1;                                                         /* return error */
+        return 4;                                                        /* return error */
     }
-    prev &= ~(7 << 2);                                                    /* clear the settings */
-    prev |= threshold << 2;                                               /* set the threshold */
-    if (a_as5600_iic_write(handle, AS5600_REG_CONF_H, &prev, 1) != 0)     /* write conf */
-    {
-        handle->debug_print("as5600: set conf failed.\n");                /* set conf failed */
 
-        return 1;                                                         /* return error */
-    }
+    handle->turn_max_step = max_step;                                    /* set the max step */
+    handle->turn_valid = 0;                                              /* clear the last sample */
+    handle->turn_alias = 0;                                              /* clear the alias counter */
+    handle->turn_position = 0;                                           /* clear the position */
 
-    return 0;                                                             /* success return 0 */
+    return 0;                                                            /* success return 0 */
 }
 
 /**
- * @brief      get the fast filter threshold
+ * @brief      update the multi turn tracker with a raw angle
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *threshold pointer to a fast filter threshold buffer
+ * @param[in]  raw raw angle
+ * @param[out] *position pointer to a position buffer
+ * @param[out] *alias pointer to an alias flag buffer
  * @return     status code
  *             - 0 success
- *             - 1 get fast filter threshold failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ *             - 4 raw angle is over 0xFFF
+ * @note       integer only and no bus access, so it can be called from an isr,
+ *             the position is 4096 per turn and the first sample sets the start position
  */
-uint8_t as5600_get_fast_filter_threshold(as5600_handle_t *handle, as5600_fast_filter_threshold_t *threshold)
+uint8_t as5600_multi_turn_update(as5600_handle_t *handle, uint16_t raw, int64_t *position, as5600_bool_t *alias)
 {
-    uint8_t prev;
-
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                         /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                               /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                    /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                               /* return error */
     }
-
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_H, &prev, 1) != 0)      /* read conf */
+    if (raw > 0xFFF)                                            /* check the raw angle */
     {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
+        handle->debug_print("as5600: raw is over 0xFFF.\n");    /* raw is over 0xFFF */
 
-        return 1;                                                         /* return error */
+        return 4;                                               /* return error */
     }
-    *threshold = (as5600_fast_filter_threshold_t)((prev >> 2) & 0x7);     /* set the threshold */
 
-    return 0;                                                             /* success return 0 */
+    a_as5600_multi_turn_update(handle, raw, position, alias);   /* update */
+
+    return 0;                                                   /* success return 0 */
 }
 
 /**
- * @brief     set the slow filter
- * @param[in] *handle pointer to an as5600 handle structure
- * @param[in] filter slow filter
- * @return    status code
- *            - 0 success
- *            - 1 set slow filter failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      read the raw angle and update the multi turn tracker
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *position pointer to a position buffer
+ * @param[out] *alias pointer to an alias flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 multi turn read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t as5600_set_slow_filter(as5600_handle_t *handle, as5600_slow_filter_t filter)
+uint8_t as5600_multi_turn_read(as5600_handle_t *handle, int64_t *position, as5600_bool_t *alias)
 {
-    uint8_t prev;
+    uint8_t buf[2];
+    uint16_t raw;
 
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                                              /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_H, &prev, 1) != 0)      /* read conf */
-    {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
-
-        return 1;                                                         /* return error */
-    }
-    prev &= ~(3 << 0);                                                    /* clear the settings */
-    prev |= filter << 0;                                                  /* set the filter */
-    if (a_as5600_iic_write(handle, AS5600_REG_CONF_H, &prev, 1) != 0)     /* write conf */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_MULTI_TURN);                  /* set the stats api */
+    if (a_as5600_verify_read(handle, AS5600_REG_RAW_ANGLE_H, buf, 2) != 0)     /* read raw angle */
     {
-        handle->debug_print("as5600: set conf failed.\n");                /* set conf failed */
+        handle->debug_print("as5600: get raw angle failed.\n");                /* get raw angle failed */
 
-        return 1;                                                         /* return error */
+        return 1;                                                              /* return error */
     }
+    a_as5600_sample_stamp(handle, 1);                                          /* stamp the sample */
+    raw = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];                     /* get the raw angle */
+    raw = a_as5600_raw_adjust(handle, raw);                                    /* apply the software zero */
+    a_as5600_multi_turn_update(handle, raw, position, alias);                  /* update */
 
-    return 0;                                                             /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief      get the slow filter
+ * @brief      get the multi turn alias counter
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *filter pointer to a slow filter buffer
+ * @param[out] *cnt pointer to a counter buffer
  * @return     status code
  *             - 0 success
- *             - 1 get slow filter failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t as5600_get_slow_filter(as5600_handle_t *handle, as5600_slow_filter_t *filter)
+uint8_t as5600_multi_turn_get_alias_count(as5600_handle_t *handle, uint32_t *cnt)
 {
-    uint8_t prev;
-
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                 /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                       /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)            /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                       /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_H, &prev, 1) != 0)      /* read conf */
+    *cnt = handle->turn_alias;          /* get the alias counter */
+
+    return 0;                           /* success return 0 */
+}
+
+/**
+ * @brief      get the timestamp of the last sample
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *timestamp_us pointer to a timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timestamp_us is null
+ * @note       the sample apis stamp the angle at the midpoint of its iic transaction,
+ *             a burst stamps its last sample and the samples before it are spaced evenly over the burst
+ */
+uint8_t as5600_get_sample_timestamp(as5600_handle_t *handle, uint32_t *timestamp_us)
+{
+    if (handle == NULL)                                              /* check handle */
+    {
+        return 2;                                                    /* return error */
+    }
+    if (handle->inited != 1)                                         /* check handle initialization */
+    {
+        return 3;                                                    /* return error */
+    }
+    if (handle->timestamp_us == NULL)                                /* check timestamp_us */
     {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
+        handle->debug_print("as5600: timestamp_us is null.\n");      /* timestamp_us is null */
 
-        return 1;                                                         /* return error */
+        return 4;                                                    /* return error */
     }
-    *filter = (as5600_slow_filter_t)(prev & 0x3);                         /* get the filter */
 
-    return 0;                                                             /* success return 0 */
+    *timestamp_us = handle->sample_timestamp;                        /* get the timestamp */
+
+    return 0;                                                        /* success return 0 */
 }
 
 /**
- * @brief     set the pwm frequency
+ * @brief     set the software zero offset
  * @param[in] *handle pointer to an as5600 handle structure
- * @param[in] freq pwm frequency
+ * @param[in] offset raw angle read as zero
  * @return    status code
  *            - 0 success
- *            - 1 set pwm frequency failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 offset is over 0xFFF
+ * @note      applied to every raw angle sample without bus traffic or otp wear,
+ *            the multi turn tracker restarts from the next sample
  */
-uint8_t as5600_set_pwm_frequency(as5600_handle_t *handle, as5600_pwm_frequency_t freq)
+uint8_t as5600_set_zero_offset(as5600_handle_t *handle, uint16_t offset)
 {
-    uint8_t prev;
-
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                                /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                                      /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                           /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                                      /* return error */
     }
-
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_L, &prev, 1) != 0)      /* read conf */
+    if (offset > 0xFFF)                                                /* check the offset */
     {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
+        handle->debug_print("as5600: offset is over 0xFFF.\n");        /* offset is over 0xFFF */
 
-        return 1;                                                         /* return error */
+        return 4;                                                      /* return error */
     }
-    prev &= ~(3 << 6);                                                    /* clear the settings */
-    prev |= freq << 6;                                                    /* set the freq */
-    if (a_as5600_iic_write(handle, AS5600_REG_CONF_L, &prev, 1) != 0)     /* write conf */
-    {
-        handle->debug_print("as5600: set conf failed.\n");                /* set conf failed */
 
-        return 1;                                                         /* return error */
-    }
+    handle->zero_offset = offset;                                      /* set the offset */
+    handle->turn_valid = 0;                                            /* restart the multi turn tracker */
 
-    return 0;                                                             /* success return 0 */
+    return 0;                                                          /* success return 0 */
 }
 
 /**
- * @brief      get the pwm frequency
+ * @brief      get the software zero offset
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *freq pointer to a pwm frequency buffer
+ * @param[out] *offset pointer to an offset buffer
  * @return     status code
  *             - 0 success
- *             - 1 get pwm frequency failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t as5600_get_pwm_frequency(as5600_handle_t *handle, as5600_pwm_frequency_t *freq)
-{
-    uint8_t prev;
-
-    if (handle == NULL)                                                   /* check handle */
-    {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
+uint8_t as5600_get_zero_offset(as5600_handle_t *handle, uint16_t *offset)
+{
+    if (handle == NULL)                   /* check handle */
     {
-        return 3;                                                         /* return error */
+        return 2;                         /* return error */
     }
-
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_L, &prev, 1) != 0)      /* read conf */
+    if (handle->inited != 1)              /* check handle initialization */
     {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
-
-        return 1;                                                         /* return error */
+        return 3;                         /* return error */
     }
-    *freq = (as5600_pwm_frequency_t)((prev >> 6) & 0x3);                  /* set the frequency */
 
-    return 0;                                                             /* success return 0 */
+    *offset = handle->zero_offset;        /* get the offset */
+
+    return 0;                             /* success return 0 */
 }
 
 /**
- * @brief     set the output stage
+ * @brief     enable or disable the software direction inversion
  * @param[in] *handle pointer to an as5600 handle structure
- * @param[in] stage output stage
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set output stage failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      the raw angle counts down when enabled and the zero offset stays at zero,
+ *            the multi turn tracker restarts from the next sample
  */
-uint8_t as5600_set_output_stage(as5600_handle_t *handle, as5600_output_stage_t stage)
+uint8_t as5600_set_direction_invert(as5600_handle_t *handle, as5600_bool_t enable)
 {
-    uint8_t prev;
-
-    if (handle == NULL)                                                   /* check handle */
-    {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle == NULL)                           /* check handle */
     {
-        return 3;                                                         /* return error */
+        return 2;                                 /* return error */
     }
-
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_L, &prev, 1) != 0)      /* read conf */
+    if (handle->inited != 1)                      /* check handle initialization */
     {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
-
-        return 1;                                                         /* return error */
+        return 3;                                 /* return error */
     }
-    prev &= ~(3 << 4);                                                    /* clear the settings */
-    prev |= stage << 4;                                                   /* set the stage */
-    if (a_as5600_iic_write(handle, AS5600_REG_CONF_L, &prev, 1) != 0)     /* write conf */
-    {
-        handle->debug_print("as5600: set conf failed.\n");                /* set conf failed */
 
-        return 1;                                                         /* return error */
-    }
+    handle->zero_invert = (uint8_t)enable;        /* set the direction */
+    handle->turn_valid = 0;                       /* restart the multi turn tracker */
 
-    return 0;                                                             /* success return 0 */
+    return 0;                                     /* success return 0 */
 }
 
 /**
- * @brief      get the output stage
+ * @brief      get the software direction inversion status
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *stage pointer to an output stage buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
- *             - 1 get output stage failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t as5600_get_output_stage(as5600_handle_t *handle, as5600_output_stage_t *stage)
+uint8_t as5600_get_direction_invert(as5600_handle_t *handle, as5600_bool_t *enable)
 {
-    uint8_t prev;
-
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                    /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                          /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                               /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                          /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_L, &prev, 1) != 0)      /* read conf */
-    {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
-
-        return 1;                                                         /* return error */
-    }
-    *stage = (as5600_output_stage_t)((prev >> 4) & 0x3);                  /* get the output stage */
+    *enable = (as5600_bool_t)(handle->zero_invert);        /* get the direction */
 
-    return 0;                                                             /* success return 0 */
+    return 0;                                              /* success return 0 */
 }
 
 /**
- * @brief     set the hysteresis
+ * @brief     take the current position as the software zero
  * @param[in] *handle pointer to an as5600 handle structure
- * @param[in] hysteresis input hysteresis
  * @return    status code
  *            - 0 success
- *            - 1 set hysteresis failed
+ *            - 1 capture zero failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      one raw angle read, the multi turn tracker restarts from the next sample
  */
-uint8_t as5600_set_hysteresis(as5600_handle_t *handle, as5600_hysteresis_t hysteresis)
+uint8_t as5600_capture_zero(as5600_handle_t *handle)
 {
-    uint8_t prev;
+    uint8_t buf[2];
 
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                                           /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                                                 /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                                      /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                                                 /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_L, &prev, 1) != 0)      /* read conf */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_REGISTER);                       /* set the stats api */
+    if (a_as5600_verify_read(handle, AS5600_REG_RAW_ANGLE_H, buf, 2) != 0)        /* read raw angle */
     {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
+        handle->debug_print("as5600: capture zero failed.\n");                    /* capture zero failed */
 
-        return 1;                                                         /* return error */
+        return 1;                                                                 /* return error */
     }
-    prev &= ~(3 << 2);                                                    /* clear the settings */
-    prev |= hysteresis << 2;                                              /* set the hysteresis */
-    if (a_as5600_iic_write(handle, AS5600_REG_CONF_L, &prev, 1) != 0)     /* write conf */
-    {
-        handle->debug_print("as5600: set conf failed.\n");                /* set conf failed */
+    handle->zero_offset = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];        /* the chip angle is the zero */
+    handle->turn_valid = 0;                                                       /* restart the multi turn tracker */
 
-        return 1;                                                         /* return error */
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the tear free read verification
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the raw angle, angle and magnitude words are checked for reserved bits and
+ *            the raw angle for a jump over the max step, only a suspicious read is repeated once,
+ *            the raw angle and angle getters, the poll, async and burst reads, the snapshot,
+ *            the ring and the field reads are verified
+ */
+uint8_t as5600_set_verify(as5600_handle_t *handle, as5600_bool_t enable)
+{
+    if (handle == NULL)                             /* check handle */
+    {
+        return 2;                                   /* return error */
+    }
+    if (handle->inited != 1)                        /* check handle initialization */
+    {
+        return 3;                                   /* return error */
     }
 
-    return 0;                                                             /* success return 0 */
+    handle->verify_enable = (uint8_t)enable;        /* set the verify */
+    handle->verify_valid = 0;                       /* no last sample */
+
+    return 0;                                       /* success return 0 */
 }
 
 /**
- * @brief      get the hysteresis
+ * @brief      get the tear free read verification status
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *hysteresis pointer to a hysteresis buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
- *             - 1 get hysteresis failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t as5600_get_hysteresis(as5600_handle_t *handle, as5600_hysteresis_t *hysteresis)
+uint8_t as5600_get_verify(as5600_handle_t *handle, as5600_bool_t *enable)
 {
-    uint8_t prev;
-
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                      /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                            /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                 /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                            /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_L, &prev, 1) != 0)      /* read conf */
-    {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
-
-        return 1;                                                         /* return error */
-    }
-    *hysteresis = (as5600_hysteresis_t)((prev >> 2) & 0x3);               /* get the hysteresis */
+    *enable = (as5600_bool_t)(handle->verify_enable);        /* get the verify */
 
-    return 0;                                                             /* success return 0 */
+    return 0;                                                /* success return 0 */
 }
 
 /**
- * @brief     set the power mode
+ * @brief     set the max plausible raw angle step of the verification
  * @param[in] *handle pointer to an as5600 handle structure
- * @param[in] mode power mode
+ * @param[in] step max raw angle step between two samples
  * @return    status code
  *            - 0 success
- *            - 1 set power mode failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 step is invalid
+ * @note      1 <= step <= 2047, default is 1024
  */
-uint8_t as5600_set_power_mode(as5600_handle_t *handle, as5600_power_mode_t mode)
+uint8_t as5600_set_verify_max_step(as5600_handle_t *handle, uint16_t step)
 {
-    uint8_t prev;
-
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                           /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                                 /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                      /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                                 /* return error */
     }
-
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_L, &prev, 1) != 0)      /* read conf */
+    if ((step == 0) || (step > 2047))                             /* check the step */
     {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
+        handle->debug_print("as5600: step is invalid.\n");        /* step is invalid */
 
-        return 1;                                                         /* return error */
+        return 4;                                                 /* return error */
     }
-    prev &= ~(3 << 0);                                                    /* clear the settings */
-    prev |= mode << 0;                                                    /* set the power mode */
-    if (a_as5600_iic_write(handle, AS5600_REG_CONF_L, &prev, 1) != 0)     /* write conf */
-    {
-        handle->debug_print("as5600: set conf failed.\n");                /* set conf failed */
 
-        return 1;                                                         /* return error */
-    }
+    handle->verify_max_step = step;                               /* set the step */
 
-    return 0;                                                             /* success return 0 */
+    return 0;                                                     /* success return 0 */
 }
 
 /**
- * @brief      get the power mode
+ * @brief      get the max plausible raw angle step of the verification
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *mode pointer to a power mode buffer
+ * @param[out] *step pointer to a step buffer
  * @return     status code
  *             - 0 success
- *             - 1 get power mode failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t as5600_get_power_mode(as5600_handle_t *handle, as5600_power_mode_t *mode)
+uint8_t as5600_get_verify_max_step(as5600_handle_t *handle, uint16_t *step)
 {
-    uint8_t prev;
-
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                     /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                           /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                           /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_CONF_L, &prev, 1) != 0)      /* read conf */
-    {
-        handle->debug_print("as5600: get conf failed.\n");                /* get conf failed */
-
-        return 1;                                                         /* return error */
-    }
-    *mode = (as5600_power_mode_t)((prev >> 0) & 0x3);                     /* get the power mode */
+    *step = handle->verify_max_step;        /* get the step */
 
-    return 0;                                                             /* success return 0 */
+    return 0;                               /* success return 0 */
 }
 
 /**
- * @brief      get the raw angle
+ * @brief      get the verification event counters
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *ang pointer to an ang buffer
+ * @param[out] *reserved pointer to a reserved bits event counter buffer
+ * @param[out] *jump pointer to a jump event counter buffer
  * @return     status code
  *             - 0 success
- *             - 1 get raw angle failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       each event costs one repeated read, also counted as a retry in the stats
  */
-uint8_t as5600_get_raw_angle(as5600_handle_t *handle, uint16_t *ang)
+uint8_t as5600_get_verify_count(as5600_handle_t *handle, uint32_t *reserved, uint32_t *jump)
 {
-    uint8_t buf[2];
-
-    if (handle == NULL)                                                        /* check handle */
+    if (handle == NULL)                         /* check handle */
     {
-        return 2;                                                              /* return error */
+        return 2;                               /* return error */
     }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    if (handle->inited != 1)                    /* check handle initialization */
     {
-        return 3;                                                              /* return error */
+        return 3;                               /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_RAW_ANGLE_H, buf, 2) != 0)        /* read conf */
-    {
-        handle->debug_print("as5600: get raw angle failed.\n");                /* get raw angle failed */
+    *reserved = handle->verify_reserved;        /* get the reserved bits events */
+    *jump = handle->verify_jump;                /* get the jump events */
 
-        return 1;                                                              /* return error */
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief     init a sample ring
+ * @param[in] *ring pointer to an as5600 ring structure
+ * @param[in] *buf pointer to a record buffer
+ * @param[in] size record buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring is NULL
+ *            - 4 size is not a power of 2
+ * @note      the buffer is owned by the caller, the ring is single producer single consumer
+ */
+uint8_t as5600_ring_init(as5600_ring_t *ring, as5600_sample_t *buf, uint32_t size)
+{
+    if ((ring == NULL) || (buf == NULL))                 /* check ring */
+    {
+        return 2;                                        /* return error */
     }
-    else
+    if ((size == 0) || ((size & (size - 1)) != 0))       /* check size */
     {
-        *ang = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];                /* set the angle */
-
-        return 0;                                                              /* success return 0 */
+        return 4;                                        /* return error */
     }
+
+    ring->buf = buf;                                     /* set the buffer */
+    ring->mask = size - 1;                               /* set the mask */
+    ring->head = 0;                                      /* clear the head */
+    ring->tail = 0;                                      /* clear the tail */
+    ring->dropped = 0;                                   /* clear the dropped counter */
+
+    return 0;                                            /* success return 0 */
 }
 
 /**
- * @brief      get the angle
- * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *ang pointer to an ang buffer
- * @return     status code
- *             - 0 success
- *             - 1 get angle failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     read one sample into the ring
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] *ring pointer to an as5600 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 handle or ring is NULL
+ *            - 3 handle is not initialized
+ *            - 4 ring is full
+ * @note      the producer side, safe from an isr or a real time thread,
+ *            the status and the raw angle are read in one transaction and stamped at its midpoint,
+ *            a sample that finds the ring full is dropped and counted,
+ *            the sequence counts every produced sample so a drop shows as a gap
  */
-uint8_t as5600_get_angle(as5600_handle_t *handle, uint16_t *ang)
+uint8_t as5600_ring_sample(as5600_handle_t *handle, as5600_ring_t *ring)
 {
-    uint8_t buf[2];
+    uint8_t buf[3];
+    uint32_t head;
+    as5600_sample_t *sample;
 
-    if (handle == NULL)                                                    /* check handle */
+    if ((handle == NULL) || (ring == NULL))                                          /* check handle and ring */
     {
-        return 2;                                                          /* return error */
+        return 2;                                                                    /* return error */
     }
-    if (handle->inited != 1)                                               /* check handle initialization */
+    if (handle->inited != 1)                                                         /* check handle initialization */
     {
-        return 3;                                                          /* return error */
+        return 3;                                                                    /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_ANGLE_H, buf, 2) != 0)        /* read conf */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_RING_SAMPLE);                       /* set the stats api */
+    if (a_as5600_verify_read(handle, AS5600_REG_STATUS, buf, 3) != 0)                /* read status and raw angle */
     {
-        handle->debug_print("as5600: get angle failed.\n");                /* get angle failed */
+        handle->debug_print("as5600: ring sample failed.\n");                        /* ring sample failed */
 
-        return 1;                                                          /* return error */
+        return 1;                                                                    /* return error */
     }
-    else
+    a_as5600_sample_stamp(handle, 1);                                                /* stamp the sample */
+    head = ring->head;                                                               /* get the head */
+    if ((head - AS5600_LOAD_ACQUIRE(&ring->tail)) > ring->mask)                      /* check full */
     {
-        *ang = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];            /* set the angle */
+        ring->dropped = ring->dropped + 1;                                           /* count the dropped sample */
 
-        return 0;                                                          /* success return 0 */
+        return 4;                                                                    /* return error */
     }
+    sample = &ring->buf[head & ring->mask];                                          /* get the record */
+    sample->timestamp_us = handle->sample_timestamp;                                 /* set the timestamp */
+    sample->raw_angle = (uint16_t)(((buf[1] >> 0) & 0xF) << 8) | buf[2];             /* set the raw angle */
+    sample->raw_angle = a_as5600_raw_adjust(handle, sample->raw_angle);              /* apply the software zero */
+    sample->status = buf[0];                                                         /* set the status */
+    sample->sequence = (uint16_t)(head + ring->dropped);                             /* set the sequence, head + dropped counts every sample */
+    AS5600_STORE_RELEASE(&ring->head, head + 1);                                     /* publish the head after the record */
+
+    return 0;                                                                        /* success return 0 */
 }
 
 /**
- * @brief      get the status
- * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *status pointer to a status buffer
+ * @brief      take one sample from the ring
+ * @param[in]  *ring pointer to an as5600 ring structure
+ * @param[out] *sample pointer to an as5600 sample structure
  * @return     status code
  *             - 0 success
- *             - 1 get status failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ *             - 2 ring is NULL
+ *             - 4 ring is empty
+ * @note       the consumer side, it never blocks the producer
  */
-uint8_t as5600_get_status(as5600_handle_t *handle, uint8_t *status)
+uint8_t as5600_ring_pop(as5600_ring_t *ring, as5600_sample_t *sample)
 {
-    if (handle == NULL)                                                      /* check handle */
+    uint32_t tail;
+
+    if (ring == NULL)                                    /* check ring */
     {
-        return 2;                                                            /* return error */
+        return 2;                                        /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+
+    tail = ring->tail;                                   /* get the tail */
+    if (AS5600_LOAD_ACQUIRE(&ring->head) == tail)        /* check empty */
     {
-        return 3;                                                            /* return error */
+        return 4;                                        /* return error */
     }
+    *sample = ring->buf[tail & ring->mask];              /* copy the record */
+    AS5600_STORE_RELEASE(&ring->tail, tail + 1);         /* release the tail after the copy */
 
-    if (a_as5600_iic_read(handle, AS5600_REG_STATUS, status, 1) != 0)        /* read conf */
-    {
-        handle->debug_print("as5600: get status failed.\n");                 /* get status failed */
+    return 0;                                            /* success return 0 */
+}
 
-        return 1;                                                            /* return error */
-    }
-    else
+/**
+ * @brief      get the ring counters
+ * @param[in]  *ring pointer to an as5600 ring structure
+ * @param[out] *count pointer to a queued samples buffer
+ * @param[out] *dropped pointer to a dropped samples buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ * @note       safe from both sides
+ */
+uint8_t as5600_ring_get_count(as5600_ring_t *ring, uint32_t *count, uint32_t *dropped)
+{
+    if (ring == NULL)                                    /* check ring */
     {
-        return 0;                                                            /* success return 0 */
+        return 2;                                        /* return error */
     }
+
+    *count = ring->head - ring->tail;                    /* get the queued samples */
+    *dropped = ring->dropped;                            /* get the dropped samples */
+
+    return 0;                                            /* success return 0 */
 }
 
 /**
- * @brief      get the automatic gain control
- * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *agc pointer to an agc buffer
+ * @brief      encode a sample into a stream frame
+ * @param[in]  *sample pointer to an as5600 sample structure
+ * @param[in]  sequence frame sequence number
+ * @param[out] *frame pointer to an AS5600_STREAM_FRAME_SIZE bytes buffer
  * @return     status code
  *             - 0 success
- *             - 1 get agc failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ *             - 2 sample or frame is NULL
+ * @note       only the md, ml and mh bits of the status are kept
  */
-uint8_t as5600_get_agc(as5600_handle_t *handle, uint8_t *agc)
+uint8_t as5600_stream_encode(const as5600_sample_t *sample, uint16_t sequence, uint8_t *frame)
 {
-    if (handle == NULL)                                                /* check handle */
+    uint16_t word;
+
+    if ((sample == NULL) || (frame == NULL))                                       /* check sample and frame */
     {
-        return 2;                                                      /* return error */
+        return 2;                                                                  /* return error */
     }
-    if (handle->inited != 1)                                           /* check handle initialization */
+
+    word = (uint16_t)((sample->raw_angle & 0xFFF) |
+                      (((sample->status >> 3) & 0x7) << 12));                      /* pack the raw angle and status */
+    frame[0] = AS5600_STREAM_SYNC_0;                                               /* set the first sync */
+    frame[1] = AS5600_STREAM_SYNC_1;                                               /* set the second sync */
+    frame[2] = (uint8_t)(sequence >> 0);                                           /* set the sequence */
+    frame[3] = (uint8_t)(sequence >> 8);                                           /* set the sequence */
+    frame[4] = (uint8_t)(sample->timestamp_us >> 0);                               /* set the timestamp */
+    frame[5] = (uint8_t)(sample->timestamp_us >> 8);                               /* set the timestamp */
+    frame[6] = (uint8_t)(sample->timestamp_us >> 16);                              /* set the timestamp */
+    frame[7] = (uint8_t)(sample->timestamp_us >> 24);                              /* set the timestamp */
+    frame[8] = (uint8_t)(word >> 0);                                               /* set the angle word */
+    frame[9] = (uint8_t)(word >> 8);                                               /* set the angle word */
+    frame[10] = a_as5600_stream_crc8(&frame[2], 8);                                /* set the crc */
+
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      decode a stream frame into a sample
+ * @param[in]  *frame pointer to an AS5600_STREAM_FRAME_SIZE bytes buffer
+ * @param[out] *sequence pointer to a frame sequence number buffer
+ * @param[out] *sample pointer to an as5600 sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 frame, sequence or sample is NULL
+ *             - 4 sync is invalid
+ *             - 5 crc is invalid
+ * @note       a reader that loses the sync moves on by one byte until a frame decodes
+ */
+uint8_t as5600_stream_decode(const uint8_t *frame, uint16_t *sequence, as5600_sample_t *sample)
+{
+    uint16_t word;
+
+    if ((frame == NULL) || (sequence == NULL) || (sample == NULL))                   /* check frame, sequence and sample */
     {
-        return 3;                                                      /* return error */
+        return 2;                                                                    /* return error */
     }
-
-    if (a_as5600_iic_read(handle, AS5600_REG_AGC, agc, 1) != 0)        /* read conf */
+    if ((frame[0] != AS5600_STREAM_SYNC_0) || (frame[1] != AS5600_STREAM_SYNC_1))    /* check the sync */
     {
-        handle->debug_print("as5600: get agc failed.\n");              /* get agc failed */
-
-        return 1;                                                      /* return error */
+        return 4;                                                                    /* return error */
     }
-    else
+    if (frame[10] != a_as5600_stream_crc8(&frame[2], 8))                             /* check the crc */
     {
-        return 0;                                                      /* success return 0 */
+        return 5;                                                                    /* return error */
     }
+
+    *sequence = (uint16_t)(frame[2] | (frame[3] << 8));                              /* get the sequence */
+    sample->sequence = *sequence;                                                    /* set the sample sequence */
+    sample->timestamp_us = (uint32_t)frame[4] | ((uint32_t)frame[5] << 8) |
+                           ((uint32_t)frame[6] << 16) | ((uint32_t)frame[7] << 24);  /* get the timestamp */
+    word = (uint16_t)(frame[8] | (frame[9] << 8));                                   /* get the angle word */
+    sample->raw_angle = word & 0xFFF;                                                /* get the raw angle */
+    sample->status = (uint8_t)(((word >> 12) & 0x7) << 3);                           /* get the status */
+
+    return 0;                                                                        /* success return 0 */
 }
 
+#if (AS5600_STATS_ENABLE == 1)
 /**
- * @brief      get the magnitude
+ * @brief      get the stats
  * @param[in]  *handle pointer to an as5600 handle structure
- * @param[out] *magnitude pointer to a magnitude buffer
+ * @param[out] *stats pointer to an as5600 stats structure
  * @return     status code
  *             - 0 success
- *             - 1 get magnitude failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the latency is only counted when timestamp_us is linked,
+ *             one call of an api is timed once from its first transaction to its last transaction
  */
-uint8_t as5600_get_magnitude(as5600_handle_t *handle, uint16_t *magnitude)
+uint8_t as5600_get_stats(as5600_handle_t *handle, as5600_stats_t *stats)
 {
-    uint8_t buf[2];
-
-    if (handle == NULL)                                                        /* check handle */
+    if (handle == NULL)                                         /* check handle */
     {
-        return 2;                                                              /* return error */
+        return 2;                                               /* return error */
     }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    if (handle->inited != 1)                                    /* check handle initialization */
     {
-        return 3;                                                              /* return error */
+        return 3;                                               /* return error */
     }
 
-    if (a_as5600_iic_read(handle, AS5600_REG_MAGNITUDE_H, buf, 2) != 0)        /* read conf */
-    {
-        handle->debug_print("as5600: get magnitude failed.\n");                /* get magnitude failed */
+    a_as5600_stats_commit(handle);                              /* count the last call */
+    memcpy(stats, &handle->stats, sizeof(as5600_stats_t));      /* copy the stats */
 
-        return 1;                                                              /* return error */
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     clear the stats
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      as5600_init also clears the stats
+ */
+uint8_t as5600_clear_stats(as5600_handle_t *handle)
+{
+    if (handle == NULL)                                         /* check handle */
+    {
+        return 2;                                               /* return error */
     }
-    else
+    if (handle->inited != 1)                                    /* check handle initialization */
     {
-        *magnitude = (uint16_t)(((buf[0] >> 0) & 0xF) << 8) | buf[1];          /* set the angle */
-
-        return 0;                                                              /* success return 0 */
+        return 3;                                               /* return error */
     }
+
+    handle->stats_call = 0;                                     /* drop the open call */
+    memset(&handle->stats, 0, sizeof(as5600_stats_t));          /* clear the stats */
+
+    return 0;                                                   /* success return 0 */
 }
+#endif
 
 /**
  * @brief     set the burn
@@ -1304,12 +4079,14 @@ uint8_t as5600_set_burn(as5600_handle_t *handle, as5600_burn_t burn)
     }
 
     prev = burn;                                                           /* set the burn */
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_REGISTER);                /* set the stats api */
     if (a_as5600_iic_write(handle, AS5600_REG_BURN, &prev, 1) != 0)        /* write conf */
     {
         handle->debug_print("as5600: set burn failed.\n");                 /* set burn failed */
 
         return 1;                                                          /* return error */
     }
+    handle->shadow_valid = 0;                                              /* otp may reload the registers */
 
     return 0;                                                              /* success return 0 */
 }
@@ -1340,6 +4117,7 @@ uint8_t as5600_set_reg(as5600_handle_t *handle, uint8_t reg, uint8_t *buf, uint1
         return 3;                                                       /* return error */
     }
 
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_REGISTER);             /* set the stats api */
     res = a_as5600_iic_write(handle, reg, buf, len);                    /* write data */
     if (res != 0)                                                       /* check result */
     {
@@ -1377,6 +4155,7 @@ uint8_t as5600_get_reg(as5600_handle_t *handle, uint8_t reg, uint8_t *buf, uint1
         return 3;                                                      /* return error */
     }
 
+    AS5600_STATS_SELECT(handle, AS5600_STATS_API_REGISTER);            /* set the stats api */
     res = a_as5600_iic_read(handle, reg, buf, len);                    /* read data */
     if (res != 0)                                                      /* check result */
     {
@@ -45,6 +45,23 @@
 extern "C"{
 #endif
 
+/**
+ * @brief as5600 float enable definition
+ * @note  set 0 to compile out the float conversion functions
+ */
+#ifndef AS5600_FLOAT_ENABLE
+    #define AS5600_FLOAT_ENABLE 1
+#endif
+
+/**
+ * @brief as5600 stats enable definition
+ * @note  set 1 to compile in the bus counters and the latency histogram,
+ *        with 0 the handle has no stats fields and the driver has no stats code
+ */
+#ifndef AS5600_STATS_ENABLE
+    #define AS5600_STATS_ENABLE 0
+#endif
+
 /**
  * @defgroup as5600_driver as5600 driver function
  * @brief    as5600 driver modules
@@ -156,6 +173,228 @@ typedef enum
     AS5600_BURN_SETTING = 0x40,        /**< setting */
 } as5600_burn_t;
 
+/**
+ * @brief as5600 poll register enumeration definition
+ */
+typedef enum
+{
+    AS5600_POLL_REGISTER_RAW_ANGLE = 0x0C,        /**< raw angle register */
+    AS5600_POLL_REGISTER_ANGLE     = 0x0E,        /**< angle register */
+    AS5600_POLL_REGISTER_MAGNITUDE = 0x1B,        /**< magnitude register */
+} as5600_poll_register_t;
+
+/**
+ * @brief as5600 fixed format enumeration definition
+ */
+typedef enum
+{
+    AS5600_FIXED_FORMAT_DEG_Q16  = 0x00,        /**< degrees in q16.16, 360 degrees is 360 << 16 */
+    AS5600_FIXED_FORMAT_TURN_Q15 = 0x01,        /**< turns in q1.15, one turn is 32768 */
+    AS5600_FIXED_FORMAT_BAM16    = 0x02,        /**< 16 bit binary angle, one turn is 65536 */
+} as5600_fixed_format_t;
+
+/**
+ * @brief as5600 field enumeration definition
+ */
+typedef enum
+{
+    AS5600_FIELD_START_POSITION        = 0x00,        /**< start position, read and write */
+    AS5600_FIELD_STOP_POSITION         = 0x01,        /**< stop position, read and write */
+    AS5600_FIELD_MAX_ANGLE             = 0x02,        /**< max angle, read and write */
+    AS5600_FIELD_WATCH_DOG             = 0x03,        /**< watch dog, read and write */
+    AS5600_FIELD_FAST_FILTER_THRESHOLD = 0x04,        /**< fast filter threshold, read and write */
+    AS5600_FIELD_SLOW_FILTER           = 0x05,        /**< slow filter, read and write */
+    AS5600_FIELD_PWM_FREQUENCY         = 0x06,        /**< pwm frequency, read and write */
+    AS5600_FIELD_OUTPUT_STAGE          = 0x07,        /**< output stage, read and write */
+    AS5600_FIELD_HYSTERESIS            = 0x08,        /**< hysteresis, read and write */
+    AS5600_FIELD_POWER_MODE            = 0x09,        /**< power mode, read and write */
+    AS5600_FIELD_STATUS                = 0x0A,        /**< status, read only */
+    AS5600_FIELD_RAW_ANGLE             = 0x0B,        /**< raw angle, read only */
+    AS5600_FIELD_ANGLE                 = 0x0C,        /**< scaled angle, read only */
+    AS5600_FIELD_AGC                   = 0x0D,        /**< automatic gain control, read only */
+    AS5600_FIELD_MAGNITUDE             = 0x0E,        /**< magnitude, read only */
+} as5600_field_t;
+
+/**
+ * @brief as5600 field number definition
+ */
+#define AS5600_FIELD_NUM        15        /**< field number */
+
+/**
+ * @brief as5600 output range definition
+ */
+#define AS5600_OUTPUT_RANGE_MIN        205        /**< minimum span of 18 degrees in raw counts */
+
+/**
+ * @brief as5600 field value structure definition
+ */
+typedef struct as5600_field_value_s
+{
+    as5600_field_t field;        /**< field */
+    uint16_t value;              /**< field value */
+} as5600_field_value_t;
+
+/**
+ * @brief as5600 stats api enumeration definition
+ */
+typedef enum
+{
+    AS5600_STATS_API_REGISTER      = 0x00,        /**< burn, register access and the other calls */
+    AS5600_STATS_API_READ          = 0x01,        /**< as5600_read */
+    AS5600_STATS_API_READ_FIXED    = 0x02,        /**< as5600_read_fixed */
+    AS5600_STATS_API_GET_RAW_ANGLE = 0x03,        /**< as5600_get_raw_angle */
+    AS5600_STATS_API_GET_ANGLE     = 0x04,        /**< as5600_get_angle */
+    AS5600_STATS_API_READ_SNAPSHOT = 0x05,        /**< as5600_read_snapshot */
+    AS5600_STATS_API_POLL_READ     = 0x06,        /**< as5600_poll_read */
+    AS5600_STATS_API_READ_BURST    = 0x07,        /**< as5600_read_burst */
+    AS5600_STATS_API_MULTI_TURN    = 0x08,        /**< as5600_multi_turn_read */
+    AS5600_STATS_API_RING_SAMPLE   = 0x09,        /**< as5600_ring_sample */
+    AS5600_STATS_API_READ_ASYNC    = 0x0A,        /**< as5600_read_start */
+    AS5600_STATS_API_CONFIG        = 0x0B,        /**< as5600_apply_config and as5600_get_config */
+    AS5600_STATS_API_OUTPUT_RANGE  = 0x0C,        /**< as5600_set_output_range */
+    AS5600_STATS_API_FIELD_SET     = 0x0D,        /**< as5600_field_set, as5600_field_set_multiple and the setters */
+    AS5600_STATS_API_FIELD_GET     = 0x0E,        /**< as5600_field_get, as5600_field_get_multiple and the getters */
+} as5600_stats_api_t;
+
+/**
+ * @brief as5600 stats size definition
+ */
+#define AS5600_STATS_API_NUM          15        /**< number of the stats apis */
+#define AS5600_STATS_HISTOGRAM_NUM    16        /**< number of the latency histogram buckets */
+
+/**
+ * @brief as5600 stats latency structure definition
+ */
+typedef struct as5600_stats_latency_s
+{
+    uint32_t count;           /**< timed calls */
+    uint32_t min_us;          /**< min latency in us */
+    uint32_t max_us;          /**< max latency in us */
+    uint64_t total_us;        /**< total latency in us, the mean is total_us / count */
+} as5600_stats_latency_t;
+
+/**
+ * @brief as5600 stats structure definition
+ */
+typedef struct as5600_stats_s
+{
+    uint32_t transactions;                                      /**< iic transactions */
+    uint32_t bytes;                                             /**< iic payload bytes */
+    uint32_t failures;                                          /**< failed iic transactions */
+    uint32_t retries;                                           /**< iic transactions repeated by the driver */
+    as5600_stats_latency_t latency[AS5600_STATS_API_NUM];       /**< call latency of every api */
+    uint32_t histogram[AS5600_STATS_HISTOGRAM_NUM];             /**< call latency histogram, bucket n counts [2^(n-1), 2^n) us */
+} as5600_stats_t;
+
+/**
+ * @brief as5600 release store and acquire load definition
+ * @note  a flag stored with release publishes the data written before it to the side that loads the flag with acquire,
+ *        used by the ring indexes and the async state, gcc, clang and armclang use the atomic builtins,
+ *        other c11 compilers use the stdatomic fences, older compilers such as armcc or iar in c99 mode
+ *        use a volatile access behind AS5600_RING_BARRIER, which is a dmb on armcc and iar and can be
+ *        defined to the barrier of any other compiler
+ */
+#if !defined(AS5600_STORE_RELEASE) || !defined(AS5600_LOAD_ACQUIRE)
+    #if defined(__GNUC__)
+        #define AS5600_STORE_RELEASE(PTR, VAL) __atomic_store_n(PTR, VAL, __ATOMIC_RELEASE)
+        #define AS5600_LOAD_ACQUIRE(PTR)       __atomic_load_n(PTR, __ATOMIC_ACQUIRE)
+    #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+        #include <stdatomic.h>
+        #define AS5600_STORE_RELEASE(PTR, VAL) do { atomic_thread_fence(memory_order_release); *(PTR) = (VAL); } while (0)
+        #define AS5600_LOAD_ACQUIRE(PTR)       as5600_acquire_fence(*(PTR))
+        
+        /**
+         * @brief     order the later loads after a loaded value
+         * @param[in] value loaded value
+         * @return    the loaded value
+         * @note      the value is loaded before the call and the acquire fence runs before the value is used
+         */
+        static inline uint32_t as5600_acquire_fence(uint32_t value)
+        {
+            atomic_thread_fence(memory_order_acquire);
+            
+            return value;
+        }
+    #else
+        #if !defined(AS5600_RING_BARRIER)
+            #if defined(__CC_ARM)
+                #define AS5600_RING_BARRIER() __dmb(0xF)
+            #elif defined(__ICCARM__)
+                #include <intrinsics.h>
+                #define AS5600_RING_BARRIER() __DMB()
+            #else
+                #define AS5600_RING_BARRIER()
+            #endif
+        #endif
+        #if defined(__CC_ARM)
+            #define AS5600_RING_INLINE __inline
+        #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+            #define AS5600_RING_INLINE inline
+        #else
+            #define AS5600_RING_INLINE
+        #endif
+        #define AS5600_STORE_RELEASE(PTR, VAL) do { AS5600_RING_BARRIER(); *(PTR) = (VAL); } while (0)
+        #define AS5600_LOAD_ACQUIRE(PTR)       as5600_acquire_fence(*(PTR))
+        
+        /**
+         * @brief     order the later loads after a loaded value
+         * @param[in] value loaded value
+         * @return    the loaded value
+         * @note      the value is a volatile load before the call and the barrier runs before the value is used
+         */
+        static AS5600_RING_INLINE uint32_t as5600_acquire_fence(uint32_t value)
+        {
+            AS5600_RING_BARRIER();
+            
+            return value;
+        }
+    #endif
+#endif
+
+/**
+ * @brief as5600 async state enumeration definition
+ */
+typedef enum
+{
+    AS5600_ASYNC_STATE_IDLE   = 0x00,        /**< no transfer */
+    AS5600_ASYNC_STATE_BUSY   = 0x01,        /**< transfer in flight */
+    AS5600_ASYNC_STATE_DONE   = 0x02,        /**< transfer done */
+    AS5600_ASYNC_STATE_FAILED = 0x03,        /**< transfer failed */
+} as5600_async_state_t;
+
+/**
+ * @brief as5600 sample structure definition
+ */
+typedef struct as5600_sample_s
+{
+    uint32_t timestamp_us;        /**< sample timestamp in us */
+    uint16_t raw_angle;           /**< raw angle */
+    uint8_t status;               /**< status register */
+    uint16_t sequence;            /**< producer sequence, it also advances on a dropped sample */
+} as5600_sample_t;
+
+/**
+ * @brief as5600 stream frame definition
+ * @note  byte 0 - 1 sync 0xA5 0x5A, byte 2 - 3 sequence, byte 4 - 7 timestamp in us,
+ *        byte 8 - 9 raw angle with the md, ml and mh status bits in bit 12 - 14,
+ *        byte 10 crc8 with the polynomial 0x07 of byte 2 - 9, all fields are little endian
+ */
+#define AS5600_STREAM_FRAME_SIZE     11          /**< stream frame size */
+#define AS5600_STREAM_SYNC_0         0xA5        /**< stream frame first sync byte */
+#define AS5600_STREAM_SYNC_1         0x5A        /**< stream frame second sync byte */
+
+/**
+ * @brief as5600 ring structure definition
+ */
+typedef struct as5600_ring_s
+{
+    as5600_sample_t *buf;           /**< record buffer */
+    uint32_t mask;                  /**< record buffer size - 1 */
+    volatile uint32_t head;         /**< write counter, only written by the producer */
+    volatile uint32_t tail;         /**< read counter, only written by the consumer */
+    volatile uint32_t dropped;      /**< dropped samples, only written by the producer */
+} as5600_ring_t;
+
 /**
  * @brief as5600 handle structure definition
  */
@@ -165,9 +404,61 @@ typedef struct as5600_handle_s
     uint8_t (*iic_deinit)(void);                                                        /**< point to an iic_deinit function address */
     uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);         /**< point to an iic_read function address */
     uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to an iic_write function address */
+    uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);                  /**< point to an iic_read_cmd function address */
     void (*delay_ms)(uint32_t ms);                                                      /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                                    /**< point to a debug_print function address */
+    void *user_data;                                                                    /**< user data passed to the ex link functions */
+    uint8_t (*iic_init_ex)(void *user_data);                                            /**< point to an iic_init_ex function address */
+    uint8_t (*iic_deinit_ex)(void *user_data);                                          /**< point to an iic_deinit_ex function address */
+    uint8_t (*iic_read_ex)(void *user_data, uint8_t addr, uint8_t reg,
+                           uint8_t *buf, uint16_t len);                                 /**< point to an iic_read_ex function address */
+    uint8_t (*iic_write_ex)(void *user_data, uint8_t addr, uint8_t reg,
+                            uint8_t *buf, uint16_t len);                                /**< point to an iic_write_ex function address */
+    uint8_t (*iic_read_cmd_ex)(void *user_data, uint8_t addr, uint8_t *buf,
+                               uint16_t len);                                           /**< point to an iic_read_cmd_ex function address */
+    uint8_t (*iic_read_repeat)(void *user_data, uint8_t addr, uint8_t reg,
+                               uint8_t *buf, uint16_t len, uint16_t num);               /**< point to an iic_read_repeat function address */
+    uint32_t (*timestamp_us)(void);                                                     /**< point to a timestamp_us function address */
+    void (*delay_us)(uint32_t us);                                                      /**< point to a delay_us function address */
+    uint8_t (*iic_read_async)(void *user_data, uint8_t addr, uint8_t reg,
+                              uint8_t *buf, uint16_t len,
+                              void (*done)(void *ctx, uint8_t res), void *ctx);         /**< point to an iic_read_async function address */
+    void (*receive_callback)(uint8_t type);                                             /**< point to a receive_callback function address */
     uint8_t inited;                                                                     /**< inited flag */
+    uint8_t poll_enable;                                                                /**< poll read enable flag */
+    uint8_t poll_reg;                                                                   /**< poll read register */
+    uint8_t poll_ready;                                                                 /**< poll address pointer ready flag */
+    uint8_t shadow_enable;                                                              /**< shadow cache enable flag */
+    uint8_t shadow_valid;                                                               /**< shadow cache valid flag */
+    uint8_t shadow[8];                                                                  /**< shadow cache of the zpos, mpos, mang and conf registers */
+    uint8_t range_valid;                                                                /**< output range cache valid flag */
+    uint32_t range_offset;                                                              /**< output range start as a 32 bit binary angle */
+    uint32_t range_scale;                                                               /**< 32 bit binary angle of one scaled angle step */
+    uint16_t zero_offset;                                                               /**< software zero offset */
+    uint8_t zero_invert;                                                                /**< software direction inversion flag */
+    uint8_t verify_enable;                                                              /**< tear free verify enable flag */
+    uint8_t verify_valid;                                                               /**< verify last sample valid flag */
+    uint16_t verify_max_step;                                                           /**< verify max raw angle step between two samples */
+    uint16_t verify_last;                                                               /**< verify last raw angle */
+    uint32_t verify_reserved;                                                           /**< verify reserved bits event counter */
+    uint32_t verify_jump;                                                               /**< verify jump event counter */
+    uint8_t turn_valid;                                                                 /**< multi turn last sample valid flag */
+    uint16_t turn_last;                                                                 /**< multi turn last raw angle */
+    uint16_t turn_max_step;                                                             /**< multi turn max step between two samples */
+    uint32_t turn_alias;                                                                /**< multi turn alias counter */
+    int64_t turn_position;                                                              /**< multi turn accumulated position */
+    uint32_t xfer_start;                                                                /**< start time of the last transaction */
+    uint32_t xfer_end;                                                                  /**< end time of the last transaction */
+    uint32_t sample_timestamp;                                                          /**< timestamp of the last sample */
+    volatile uint8_t async_state;                                                       /**< async read state */
+    uint8_t async_buf[2];                                                               /**< async read buffer */
+#if (AS5600_STATS_ENABLE == 1)
+    uint8_t stats_api;                                                                  /**< stats api of the current call */
+    uint8_t stats_call;                                                                 /**< current call has a timed transaction */
+    uint32_t stats_call_start;                                                          /**< start time of the current call */
+    uint32_t stats_call_end;                                                            /**< end time of the current call */
+    as5600_stats_t stats;                                                               /**< stats */
+#endif
 } as5600_handle_t;
 
 /**
@@ -186,6 +477,35 @@ typedef struct as5600_info_s
     uint32_t driver_version;           /**< driver version */
 } as5600_info_t;
 
+/**
+ * @brief as5600 snapshot structure definition
+ */
+typedef struct as5600_snapshot_s
+{
+    uint8_t status;            /**< status register */
+    uint16_t raw_angle;        /**< raw angle */
+    uint16_t angle;            /**< scaled angle */
+    uint8_t agc;               /**< automatic gain control */
+    uint16_t magnitude;        /**< magnitude */
+} as5600_snapshot_t;
+
+/**
+ * @brief as5600 config structure definition
+ */
+typedef struct as5600_config_s
+{
+    uint16_t start_position;                                  /**< start position */
+    uint16_t stop_position;                                   /**< stop position */
+    uint16_t max_angle;                                       /**< max angle */
+    as5600_bool_t watch_dog;                                  /**< watch dog */
+    as5600_fast_filter_threshold_t fast_filter_threshold;     /**< fast filter threshold */
+    as5600_slow_filter_t slow_filter;                         /**< slow filter */
+    as5600_pwm_frequency_t pwm_frequency;                     /**< pwm frequency */
+    as5600_output_stage_t output_stage;                       /**< output stage */
+    as5600_hysteresis_t hysteresis;                           /**< hysteresis */
+    as5600_power_mode_t power_mode;                           /**< power mode */
+} as5600_config_t;
+
 /**
  * @}
  */
@@ -237,6 +557,103 @@ typedef struct as5600_info_s
  */
 #define DRIVER_AS5600_LINK_IIC_WRITE(HANDLE, FUC)            (HANDLE)->iic_write = FUC
 
+/**
+ * @brief     link iic_read_cmd function
+ * @param[in] HANDLE pointer to an as5600 handle structure
+ * @param[in] FUC pointer to an iic_read_cmd function address
+ * @note      only needed by the poll read mode
+ */
+#define DRIVER_AS5600_LINK_IIC_READ_CMD(HANDLE, FUC)         (HANDLE)->iic_read_cmd = FUC
+
+/**
+ * @brief     link user data
+ * @param[in] HANDLE pointer to an as5600 handle structure
+ * @param[in] DATA pointer to the user data
+ * @note      the user data is passed as the first argument of every ex link function
+ */
+#define DRIVER_AS5600_LINK_USER_DATA(HANDLE, DATA)           (HANDLE)->user_data = (void *)(DATA)
+
+/**
+ * @brief     link iic_init_ex function
+ * @param[in] HANDLE pointer to an as5600 handle structure
+ * @param[in] FUC pointer to an iic_init_ex function address
+ * @note      the ex function is used instead of iic_init when it is linked
+ */
+#define DRIVER_AS5600_LINK_IIC_INIT_EX(HANDLE, FUC)          (HANDLE)->iic_init_ex = FUC
+
+/**
+ * @brief     link iic_deinit_ex function
+ * @param[in] HANDLE pointer to an as5600 handle structure
+ * @param[in] FUC pointer to an iic_deinit_ex function address
+ * @note      the ex function is used instead of iic_deinit when it is linked
+ */
+#define DRIVER_AS5600_LINK_IIC_DEINIT_EX(HANDLE, FUC)        (HANDLE)->iic_deinit_ex = FUC
+
+/**
+ * @brief     link iic_read_ex function
+ * @param[in] HANDLE pointer to an as5600 handle structure
+ * @param[in] FUC pointer to an iic_read_ex function address
+ * @note      the ex function is used instead of iic_read when it is linked
+ */
+#define DRIVER_AS5600_LINK_IIC_READ_EX(HANDLE, FUC)          (HANDLE)->iic_read_ex = FUC
+
+/**
+ * @brief     link iic_write_ex function
+ * @param[in] HANDLE pointer to an as5600 handle structure
+ * @param[in] FUC pointer to an iic_write_ex function address
+ * @note      the ex function is used instead of iic_write when it is linked
+ */
+#define DRIVER_AS5600_LINK_IIC_WRITE_EX(HANDLE, FUC)         (HANDLE)->iic_write_ex = FUC
+
+/**
+ * @brief     link iic_read_cmd_ex function
+ * @param[in] HANDLE pointer to an as5600 handle structure
+ * @param[in] FUC pointer to an iic_read_cmd_ex function address
+ * @note      the ex function is used instead of iic_read_cmd when it is linked
+ */
+#define DRIVER_AS5600_LINK_IIC_READ_CMD_EX(HANDLE, FUC)      (HANDLE)->iic_read_cmd_ex = FUC
+
+/**
+ * @brief     link iic_read_repeat function
+ * @param[in] HANDLE pointer to an as5600 handle structure
+ * @param[in] FUC pointer to an iic_read_repeat function address
+ * @note      only needed by the burst read
+ */
+#define DRIVER_AS5600_LINK_IIC_READ_REPEAT(HANDLE, FUC)      (HANDLE)->iic_read_repeat = FUC
+
+/**
+ * @brief     link timestamp_us function
+ * @param[in] HANDLE pointer to an as5600 handle structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      a free running us counter that may wrap, it times the iic transactions and stamps the samples
+ */
+#define DRIVER_AS5600_LINK_TIMESTAMP_US(HANDLE, FUC)         (HANDLE)->timestamp_us = FUC
+
+/**
+ * @brief     link delay_us function
+ * @param[in] HANDLE pointer to an as5600 handle structure
+ * @param[in] FUC pointer to a delay_us function address
+ * @note      optional, for the sub millisecond sample periods of the application
+ */
+#define DRIVER_AS5600_LINK_DELAY_US(HANDLE, FUC)             (HANDLE)->delay_us = FUC
+
+/**
+ * @brief     link iic_read_async function
+ * @param[in] HANDLE pointer to an as5600 handle structure
+ * @param[in] FUC pointer to an iic_read_async function address
+ * @note      starts a read and returns at once, the bus calls done(ctx, res) from its completion context,
+ *            only needed by the async read
+ */
+#define DRIVER_AS5600_LINK_IIC_READ_ASYNC(HANDLE, FUC)       (HANDLE)->iic_read_async = FUC
+
+/**
+ * @brief     link receive_callback function
+ * @param[in] HANDLE pointer to an as5600 handle structure
+ * @param[in] FUC pointer to a receive_callback function address
+ * @note      optional, called with an as5600_async_state_t from the async completion context
+ */
+#define DRIVER_AS5600_LINK_RECEIVE_CALLBACK(HANDLE, FUC)     (HANDLE)->receive_callback = FUC
+
 /**
  * @brief     link delay_ms function
  * @param[in] HANDLE pointer to an as5600 handle structure
@@ -298,6 +715,8 @@ uint8_t as5600_init(as5600_handle_t *handle);
  */
 uint8_t as5600_deinit(as5600_handle_t *handle);
 
+#if (AS5600_FLOAT_ENABLE == 1)
+
 /**
  * @brief      read the magnetic angle
  * @param[in]  *handle pointer to an as5600 handle structure
@@ -338,6 +757,170 @@ uint8_t as5600_angle_convert_to_register(as5600_handle_t *handle, float deg, uin
  */
 uint8_t as5600_angle_convert_to_data(as5600_handle_t *handle, uint16_t reg, float *deg);
 
+#endif
+
+/**
+ * @brief      read the magnetic angle in a fixed point format
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  format fixed point format
+ * @param[out] *angle_raw pointer to a raw angle buffer
+ * @param[out] *angle pointer to a converted angle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 format is invalid
+ * @note       integer only
+ */
+uint8_t as5600_read_fixed(as5600_handle_t *handle, as5600_fixed_format_t format, uint16_t *angle_raw, int32_t *angle);
+
+/**
+ * @brief      convert a fixed point angle to the register raw data
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  format fixed point format
+ * @param[in]  angle fixed point angle
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 format is invalid
+ *             - 5 angle is over one turn
+ * @note       0 <= angle < one turn
+ */
+uint8_t as5600_angle_convert_from_fixed(as5600_handle_t *handle, as5600_fixed_format_t format, int32_t angle, uint16_t *reg);
+
+/**
+ * @brief      convert the register raw data to a fixed point angle
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  format fixed point format
+ * @param[in]  reg register raw data
+ * @param[out] *angle pointer to a fixed point angle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 format is invalid
+ * @note       none
+ */
+uint8_t as5600_angle_convert_to_fixed(as5600_handle_t *handle, as5600_fixed_format_t format, uint16_t reg, int32_t *angle);
+
+/**
+ * @brief     load the output range and cache the scaled angle conversion
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 range load failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the start position, stop position and max angle are read once,
+ *            any later write to them drops the cache except as5600_set_output_range which refreshes it
+ */
+uint8_t as5600_range_load(as5600_handle_t *handle);
+
+/**
+ * @brief      convert the scaled angle register to a fixed point angle
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  format fixed point format
+ * @param[in]  reg scaled angle register raw data
+ * @param[out] *angle pointer to a fixed point angle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 format is invalid
+ *             - 5 range is not loaded
+ * @note       the angle is the physical position, start position and span included
+ */
+uint8_t as5600_range_convert_to_fixed(as5600_handle_t *handle, as5600_fixed_format_t format, uint16_t reg, int32_t *angle);
+
+#if (AS5600_FLOAT_ENABLE == 1)
+
+/**
+ * @brief      convert the scaled angle register to degrees
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  reg scaled angle register raw data
+ * @param[out] *deg pointer to a degrees buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 range is not loaded
+ * @note       the angle is the physical position, start position and span included
+ */
+uint8_t as5600_range_convert_to_data(as5600_handle_t *handle, uint16_t reg, float *deg);
+
+#endif
+
+#if (AS5600_FLOAT_ENABLE == 1)
+
+/**
+ * @brief      convert an array of register raw data to angles in degrees
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  *reg pointer to a register raw data array
+ * @param[out] *deg pointer to an angle array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       reg and deg must not overlap
+ */
+uint8_t as5600_angle_convert_to_data_array(as5600_handle_t *handle, const uint16_t *reg, float *deg, uint32_t len);
+
+/**
+ * @brief      convert an array of register raw data to angles in radians
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  *reg pointer to a register raw data array
+ * @param[out] *rad pointer to an angle array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       reg and rad must not overlap
+ */
+uint8_t as5600_angle_convert_to_rad_array(as5600_handle_t *handle, const uint16_t *reg, float *rad, uint32_t len);
+
+#endif
+
+/**
+ * @brief      convert an array of register raw data to fixed point angles
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  format fixed point format
+ * @param[in]  *reg pointer to a register raw data array
+ * @param[out] *angle pointer to a fixed point angle array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 format is invalid
+ * @note       reg and angle must not overlap
+ */
+uint8_t as5600_angle_convert_to_fixed_array(as5600_handle_t *handle, as5600_fixed_format_t format,
+                                            const uint16_t *reg, int32_t *angle, uint32_t len);
+
+/**
+ * @brief         unwrap an array of register raw data to positions
+ * @param[in]     *handle pointer to an as5600 handle structure
+ * @param[in]     *reg pointer to a register raw data array
+ * @param[out]    *position pointer to a position array
+ * @param[in]     len array length
+ * @param[in,out] *last_raw pointer to the raw data before reg[0], it is set to the last raw data
+ * @param[in,out] *last_position pointer to the position of *last_raw, it is set to the last position
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          the position is 4096 per turn as in as5600_multi_turn_update and each step takes the shortest path,
+ *                consecutive blocks are chained by passing the same last_raw and last_position,
+ *                set them to reg[0] and reg[0] & 0xFFF before the first block, reg and position must not overlap
+ */
+uint8_t as5600_angle_unwrap_array(as5600_handle_t *handle, const uint16_t *reg, int64_t *position, uint32_t len,
+                                  uint16_t *last_raw, int64_t *last_position);
+
 /**
  * @brief     set the start position
  * @param[in] *handle pointer to an as5600 handle structure
@@ -419,6 +1002,25 @@ uint8_t as5600_set_max_angle(as5600_handle_t *handle, uint16_t ang);
  */
 uint8_t as5600_get_max_angle(as5600_handle_t *handle, uint16_t *ang);
 
+/**
+ * @brief     set the start position, stop position and max angle in one transaction
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] start start position
+ * @param[in] stop stop position, 0 means not used
+ * @param[in] ang max angle, 0 means not used
+ * @return    status code
+ *            - 0 success
+ *            - 1 set output range failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 start, stop or ang is over 0xFFF
+ *            - 5 span is below 18 degrees
+ *            - 6 verify failed
+ * @note      the span from start to stop and the max angle must be at least AS5600_OUTPUT_RANGE_MIN,
+ *            registers from 0x01 to 0x06 are written by one burst and checked by one burst read back
+ */
+uint8_t as5600_set_output_range(as5600_handle_t *handle, uint16_t start, uint16_t stop, uint16_t ang);
+
 /**
  * @brief     enable or disable the watch dog
  * @param[in] *handle pointer to an as5600 handle structure
@@ -666,6 +1268,563 @@ uint8_t as5600_get_agc(as5600_handle_t *handle, uint8_t *agc);
  */
 uint8_t as5600_get_magnitude(as5600_handle_t *handle, uint16_t *magnitude);
 
+/**
+ * @brief      read the status, raw angle, angle, agc and magnitude in one snapshot
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  diagnostic bool value, read the agc and magnitude or not
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read snapshot failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       status, raw angle and angle are read by one burst from 0x0B to 0x0F,
+ *             agc and magnitude are read by a second burst from 0x1A to 0x1C only when diagnostic is true,
+ *             otherwise agc and magnitude are set to 0
+ */
+uint8_t as5600_read_snapshot(as5600_handle_t *handle, as5600_bool_t diagnostic, as5600_snapshot_t *snapshot);
+
+/**
+ * @brief     start the poll read
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] reg poll register
+ * @return    status code
+ *            - 0 success
+ *            - 1 start poll read failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 iic_read_cmd is null
+ * @note      the chip keeps the address pointer at the high byte of the raw angle, angle and magnitude registers,
+ *            so after the pointer is set once every poll read is a read only transfer without the register address
+ */
+uint8_t as5600_start_poll_read(as5600_handle_t *handle, as5600_poll_register_t reg);
+
+/**
+ * @brief      poll read the register
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *data pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 poll read is not started
+ * @note       any other register access moves the address pointer and the next poll read sets it again,
+ *             with the verification enabled a suspicious read is repeated once with the register address
+ */
+uint8_t as5600_poll_read(as5600_handle_t *handle, uint16_t *data);
+
+/**
+ * @brief     stop the poll read
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t as5600_stop_poll_read(as5600_handle_t *handle);
+
+/**
+ * @brief     start an async raw angle read
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 iic_read_async is null
+ *            - 5 async read is busy
+ * @note      the call returns once the transfer is queued, the result is taken by as5600_read_poll,
+ *            no other api may use the handle until the transfer completes
+ */
+uint8_t as5600_read_start(as5600_handle_t *handle);
+
+/**
+ * @brief      poll an async raw angle read
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *angle_raw pointer to a raw angle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read poll failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 transfer is in flight
+ *             - 5 async read is not started
+ * @note       never blocks, a completed transfer is taken once and the state goes back to idle,
+ *             the sample is stamped like a blocking read, with the verification enabled a suspicious
+ *             sample is counted and fails with 1 instead of being read again
+ */
+uint8_t as5600_read_poll(as5600_handle_t *handle, uint16_t *angle_raw);
+
+/**
+ * @brief      read the raw angle n times back to back
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *raw pointer to a raw angle array
+ * @param[in]  n sample number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read burst failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 iic_read_repeat is null
+ * @note       the address pointer is set once and then every sample is a read only transfer,
+ *             the samples are read in place into the raw array, with the verification enabled
+ *             every sample is checked and a suspicious one is read again once by itself
+ */
+uint8_t as5600_read_burst(as5600_handle_t *handle, uint16_t *raw, size_t n);
+
+/**
+ * @brief     enable or disable the shadow cache
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the shadow cache is a write through copy of the zpos, mpos, mang and conf registers,
+ *            it is loaded by one burst read at the first access and then the setters only write and the getters don't access the bus
+ */
+uint8_t as5600_set_shadow_cache(as5600_handle_t *handle, as5600_bool_t enable);
+
+/**
+ * @brief      get the shadow cache status
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_shadow_cache(as5600_handle_t *handle, as5600_bool_t *enable);
+
+/**
+ * @brief     refresh the shadow cache
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 refresh shadow cache failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 shadow cache is disabled
+ * @note      none
+ */
+uint8_t as5600_shadow_cache_refresh(as5600_handle_t *handle);
+
+/**
+ * @brief     invalidate the shadow cache
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it when the registers are changed outside the driver,
+ *            the next access reloads the shadow cache
+ */
+uint8_t as5600_shadow_cache_invalidate(as5600_handle_t *handle);
+
+/**
+ * @brief     apply the whole configuration
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] *config pointer to a config structure
+ * @param[in] diff bool value, only write the changed bytes or not
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply config failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 position or angle is over 0xFFF
+ * @note      registers from 0x01 to 0x08 are written by one burst,
+ *            if diff is true the current registers are read first and only the span of the changed bytes is written,
+ *            the reserved bits 7:6 of conf high are read back and kept in both cases
+ */
+uint8_t as5600_apply_config(as5600_handle_t *handle, const as5600_config_t *config, as5600_bool_t diff);
+
+/**
+ * @brief      get the whole configuration
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get config failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       registers from 0x01 to 0x08 are read by one burst
+ */
+uint8_t as5600_get_config(as5600_handle_t *handle, as5600_config_t *config);
+
+/**
+ * @brief     set one register field
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] field register field
+ * @param[in] value field value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set field failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 field is invalid
+ *            - 5 field is read only
+ *            - 6 value is over the field width
+ * @note      the other fields in the same register are kept
+ */
+uint8_t as5600_field_set(as5600_handle_t *handle, as5600_field_t field, uint16_t value);
+
+/**
+ * @brief      get one register field
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  field register field
+ * @param[out] *value pointer to a field value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get field failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 field is invalid
+ * @note       the raw angle field gets the software zero like as5600_get_raw_angle
+ */
+uint8_t as5600_field_get(as5600_handle_t *handle, as5600_field_t field, uint16_t *value);
+
+/**
+ * @brief     set several register fields in one transaction
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] *list pointer to a field value list
+ * @param[in] num list length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set fields failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 field is invalid
+ *            - 5 field is read only
+ *            - 6 value is over the field width
+ * @note      the span of the touched registers is read once if a register is only partly covered and written by one burst,
+ *            a later entry of the same field wins and nothing is written if one entry is rejected
+ */
+uint8_t as5600_field_set_multiple(as5600_handle_t *handle, const as5600_field_value_t *list, uint8_t num);
+
+/**
+ * @brief         get several register fields
+ * @param[in]     *handle pointer to an as5600 handle structure
+ * @param[in,out] *list pointer to a field value list
+ * @param[in]     num list length
+ * @return        status code
+ *                - 0 success
+ *                - 1 get fields failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 field is invalid
+ * @note          the fields are grouped by the config, output and magnet register blocks,
+ *                each touched block is read by one burst and the raw angle field gets the software zero
+ */
+uint8_t as5600_field_get_multiple(as5600_handle_t *handle, as5600_field_value_t *list, uint8_t num);
+
+/**
+ * @brief     initialize the multi turn tracker
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] max_step max raw angle step between two samples
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 max step is invalid
+ * @note      1 <= max_step <= 2047,
+ *            a larger step between two samples is flagged as aliasing,
+ *            the position and the alias counter are cleared
+ */
+uint8_t as5600_multi_turn_init(as5600_handle_t *handle, uint16_t max_step);
+
+/**
+ * @brief      update the multi turn tracker with a raw angle
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[in]  raw raw angle
+ * @param[out] *position pointer to a position buffer
+ * @param[out] *alias pointer to an alias flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 raw angle is over 0xFFF
+ * @note       integer only and no bus access, so it can be called from an isr,
+ *             the position is 4096 per turn and the first sample sets the start position
+ */
+uint8_t as5600_multi_turn_update(as5600_handle_t *handle, uint16_t raw, int64_t *position, as5600_bool_t *alias);
+
+/**
+ * @brief      read the raw angle and update the multi turn tracker
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *position pointer to a position buffer
+ * @param[out] *alias pointer to an alias flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 multi turn read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_multi_turn_read(as5600_handle_t *handle, int64_t *position, as5600_bool_t *alias);
+
+/**
+ * @brief      get the multi turn alias counter
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *cnt pointer to a counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_multi_turn_get_alias_count(as5600_handle_t *handle, uint32_t *cnt);
+
+/**
+ * @brief      get the timestamp of the last sample
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *timestamp_us pointer to a timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timestamp_us is null
+ * @note       the sample apis stamp the angle at the midpoint of its iic transaction,
+ *             a burst stamps its last sample and the samples before it are spaced evenly over the burst
+ */
+uint8_t as5600_get_sample_timestamp(as5600_handle_t *handle, uint32_t *timestamp_us);
+
+/**
+ * @brief     set the software zero offset
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] offset raw angle read as zero
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 offset is over 0xFFF
+ * @note      applied to every raw angle sample without bus traffic or otp wear,
+ *            the multi turn tracker restarts from the next sample
+ */
+uint8_t as5600_set_zero_offset(as5600_handle_t *handle, uint16_t offset);
+
+/**
+ * @brief      get the software zero offset
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *offset pointer to an offset buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_zero_offset(as5600_handle_t *handle, uint16_t *offset);
+
+/**
+ * @brief     enable or disable the software direction inversion
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the raw angle counts down when enabled and the zero offset stays at zero,
+ *            the multi turn tracker restarts from the next sample
+ */
+uint8_t as5600_set_direction_invert(as5600_handle_t *handle, as5600_bool_t enable);
+
+/**
+ * @brief      get the software direction inversion status
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_direction_invert(as5600_handle_t *handle, as5600_bool_t *enable);
+
+/**
+ * @brief     take the current position as the software zero
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 capture zero failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      one raw angle read, the multi turn tracker restarts from the next sample
+ */
+uint8_t as5600_capture_zero(as5600_handle_t *handle);
+
+/**
+ * @brief     enable or disable the tear free read verification
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the raw angle, angle and magnitude words are checked for reserved bits and
+ *            the raw angle for a jump over the max step, only a suspicious read is repeated once,
+ *            the raw angle and angle getters, the poll, async and burst reads, the snapshot,
+ *            the ring and the field reads are verified
+ */
+uint8_t as5600_set_verify(as5600_handle_t *handle, as5600_bool_t enable);
+
+/**
+ * @brief      get the tear free read verification status
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_verify(as5600_handle_t *handle, as5600_bool_t *enable);
+
+/**
+ * @brief     set the max plausible raw angle step of the verification
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] step max raw angle step between two samples
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 step is invalid
+ * @note      1 <= step <= 2047, default is 1024
+ */
+uint8_t as5600_set_verify_max_step(as5600_handle_t *handle, uint16_t step);
+
+/**
+ * @brief      get the max plausible raw angle step of the verification
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *step pointer to a step buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t as5600_get_verify_max_step(as5600_handle_t *handle, uint16_t *step);
+
+/**
+ * @brief      get the verification event counters
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *reserved pointer to a reserved bits event counter buffer
+ * @param[out] *jump pointer to a jump event counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       each event costs one repeated read, also counted as a retry in the stats
+ */
+uint8_t as5600_get_verify_count(as5600_handle_t *handle, uint32_t *reserved, uint32_t *jump);
+
+/**
+ * @brief     init a sample ring
+ * @param[in] *ring pointer to an as5600 ring structure
+ * @param[in] *buf pointer to a record buffer
+ * @param[in] size record buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring is NULL
+ *            - 4 size is not a power of 2
+ * @note      the buffer is owned by the caller, the ring is single producer single consumer
+ */
+uint8_t as5600_ring_init(as5600_ring_t *ring, as5600_sample_t *buf, uint32_t size);
+
+/**
+ * @brief     read one sample into the ring
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] *ring pointer to an as5600 ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ *            - 2 handle or ring is NULL
+ *            - 3 handle is not initialized
+ *            - 4 ring is full
+ * @note      the producer side, safe from an isr or a real time thread,
+ *            the status and the raw angle are read in one transaction and stamped at its midpoint,
+ *            a sample that finds the ring full is dropped and counted,
+ *            the sequence counts every produced sample so a drop shows as a gap
+ */
+uint8_t as5600_ring_sample(as5600_handle_t *handle, as5600_ring_t *ring);
+
+/**
+ * @brief      take one sample from the ring
+ * @param[in]  *ring pointer to an as5600 ring structure
+ * @param[out] *sample pointer to an as5600 sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ *             - 4 ring is empty
+ * @note       the consumer side, it never blocks the producer
+ */
+uint8_t as5600_ring_pop(as5600_ring_t *ring, as5600_sample_t *sample);
+
+/**
+ * @brief      get the ring counters
+ * @param[in]  *ring pointer to an as5600 ring structure
+ * @param[out] *count pointer to a queued samples buffer
+ * @param[out] *dropped pointer to a dropped samples buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring is NULL
+ * @note       safe from both sides
+ */
+uint8_t as5600_ring_get_count(as5600_ring_t *ring, uint32_t *count, uint32_t *dropped);
+
+/**
+ * @brief      encode a sample into a stream frame
+ * @param[in]  *sample pointer to an as5600 sample structure
+ * @param[in]  sequence frame sequence number
+ * @param[out] *frame pointer to an AS5600_STREAM_FRAME_SIZE bytes buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sample or frame is NULL
+ * @note       only the md, ml and mh bits of the status are kept
+ */
+uint8_t as5600_stream_encode(const as5600_sample_t *sample, uint16_t sequence, uint8_t *frame);
+
+/**
+ * @brief      decode a stream frame into a sample
+ * @param[in]  *frame pointer to an AS5600_STREAM_FRAME_SIZE bytes buffer
+ * @param[out] *sequence pointer to a frame sequence number buffer
+ * @param[out] *sample pointer to an as5600 sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 frame, sequence or sample is NULL
+ *             - 4 sync is invalid
+ *             - 5 crc is invalid
+ * @note       a reader that loses the sync moves on by one byte until a frame decodes
+ */
+uint8_t as5600_stream_decode(const uint8_t *frame, uint16_t *sequence, as5600_sample_t *sample);
+
+#if (AS5600_STATS_ENABLE == 1)
+/**
+ * @brief      get the stats
+ * @param[in]  *handle pointer to an as5600 handle structure
+ * @param[out] *stats pointer to an as5600 stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the latency is only counted when timestamp_us is linked,
+ *             one call of an api is timed once from its first transaction to its last transaction
+ */
+uint8_t as5600_get_stats(as5600_handle_t *handle, as5600_stats_t *stats);
+
+/**
+ * @brief     clear the stats
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      as5600_init also clears the stats
+ */
+uint8_t as5600_clear_stats(as5600_handle_t *handle);
+#endif
+
 /**
  * @brief     set the burn
  * @param[in] *handle pointer to an as5600 handle structure
@@ -0,0 +1,335 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_as5600_burst_test.c
+ * @brief     driver as5600 burst test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-09-30
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/09/30  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+ 
+#include "driver_as5600_burst_test.h"
+#include <stdlib.h>
+
+/**
+ * @brief burst test max samples definition
+ */
+#define AS5600_BURST_TEST_MAX_SAMPLES 1000        /**< max samples */
+#define AS5600_BURST_TEST_CHUNK       0xFFFF      /**< max reads of one iic_read_repeat call */
+
+/**
+ * @brief as5600 mock bus structure definition
+ */
+typedef struct as5600_mock_bus_s
+{
+    uint16_t angle;             /**< current raw angle */
+    uint16_t step;              /**< raw angle step per sample */
+    uint32_t calls;             /**< iic_read_repeat call counter */
+    uint32_t reads;             /**< reads requested by the iic_read_repeat calls */
+    uint32_t errors;            /**< iic_read_repeat calls with a wrong address, register or length */
+} as5600_mock_bus_t;
+
+static as5600_handle_t gs_handle;                                     /**< as5600 handle */
+static as5600_mock_bus_t gs_bus;                                      /**< mock bus */
+static uint16_t gs_raw[AS5600_BURST_TEST_MAX_SAMPLES];                /**< raw buffer */
+
+/**
+ * @brief     mock iic bus init
+ * @param[in] *user_data pointer to a mock bus structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_mock_iic_init(void *user_data)
+{
+    as5600_mock_bus_t *bus = (as5600_mock_bus_t *)user_data;
+    
+    bus->calls = 0;
+    bus->reads = 0;
+    bus->errors = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     mock iic bus deinit
+ * @param[in] *user_data pointer to a mock bus structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_mock_iic_deinit(void *user_data)
+{
+    (void)user_data;
+    
+    return 0;
+}
+
+/**
+ * @brief      get the next mock sample
+ * @param[in]  *bus pointer to a mock bus structure
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @note       the sample is returned high byte first
+ */
+static void a_mock_sample(as5600_mock_bus_t *bus, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = (i % 2 == 0) ? (uint8_t)((bus->angle >> 8) & 0x0F) : (uint8_t)(bus->angle & 0xFF);
+    }
+    bus->angle = (uint16_t)((bus->angle + bus->step) & 0xFFF);
+}
+
+/**
+ * @brief      mock iic bus read
+ * @param[in]  *user_data pointer to a mock bus structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ * @note       one register write and one read
+ */
+static uint8_t a_mock_iic_read(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    as5600_mock_bus_t *bus = (as5600_mock_bus_t *)user_data;
+    
+    (void)addr;
+    (void)reg;
+    a_mock_sample(bus, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief     mock iic bus write
+ * @param[in] *user_data pointer to a mock bus structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_mock_iic_write(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)user_data;
+    (void)addr;
+    (void)reg;
+    (void)buf;
+    (void)len;
+    
+    return 0;
+}
+
+/**
+ * @brief      mock iic bus repeated read
+ * @param[in]  *user_data pointer to a mock bus structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of one read
+ * @param[in]  num read times
+ * @return     status code
+ *             - 0 success
+ * @note       records what the driver asks for, the I2C_RDWR packing of the linux port is checked by the host iic test
+ */
+static uint8_t a_mock_iic_read_repeat(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    as5600_mock_bus_t *bus = (as5600_mock_bus_t *)user_data;
+    uint16_t i;
+    
+    if ((addr != 0x6C) || (reg != 0x0C) || (len != 2) || (num == 0))
+    {
+        bus->errors += 1;
+    }
+    for (i = 0; i < num; i++)
+    {
+        a_mock_sample(bus, buf + (uint32_t)i * len, len);
+    }
+    bus->calls += 1;
+    bus->reads += num;
+    
+    return 0;
+}
+
+/**
+ * @brief     mock delay
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_mock_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     burst test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test runs on a mock bus and needs no chip
+ */
+uint8_t as5600_burst_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t j;
+    uint16_t *raw;
+    
+    /* link interface function */
+    DRIVER_AS5600_LINK_INIT(&gs_handle, as5600_handle_t);
+    DRIVER_AS5600_LINK_USER_DATA(&gs_handle, &gs_bus);
+    DRIVER_AS5600_LINK_IIC_INIT_EX(&gs_handle, a_mock_iic_init);
+    DRIVER_AS5600_LINK_IIC_DEINIT_EX(&gs_handle, a_mock_iic_deinit);
+    DRIVER_AS5600_LINK_IIC_READ_EX(&gs_handle, a_mock_iic_read);
+    DRIVER_AS5600_LINK_IIC_WRITE_EX(&gs_handle, a_mock_iic_write);
+    DRIVER_AS5600_LINK_IIC_READ_REPEAT(&gs_handle, a_mock_iic_read_repeat);
+    DRIVER_AS5600_LINK_DELAY_MS(&gs_handle, a_mock_delay_ms);
+    DRIVER_AS5600_LINK_DEBUG_PRINT(&gs_handle, as5600_interface_debug_print);
+    
+    /* as5600 init */
+    res = as5600_init(&gs_handle);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* start burst test */
+    as5600_interface_debug_print("as5600: start burst test.\n");
+    
+    for (i = 0; i < times; i++)
+    {
+        uint32_t n;
+        uint16_t start;
+        
+        /* set the mock */
+        n = (uint32_t)(rand() % AS5600_BURST_TEST_MAX_SAMPLES) + 1;
+        start = (uint16_t)(rand() % 4096);
+        gs_bus.angle = start;
+        gs_bus.step = (uint16_t)(rand() % 64);
+        gs_bus.calls = 0;
+        gs_bus.reads = 0;
+        gs_bus.errors = 0;
+        
+        /* read burst */
+        res = as5600_read_burst(&gs_handle, gs_raw, n);
+        if (res != 0)
+        {
+            as5600_interface_debug_print("as5600: read burst failed.\n");
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* check the samples */
+        for (j = 0; j < n; j++)
+        {
+            if (gs_raw[j] != (uint16_t)((start + j * gs_bus.step) & 0xFFF))
+            {
+                as5600_interface_debug_print("as5600: check sample %d error.\n", j);
+                (void)as5600_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        as5600_interface_debug_print("as5600: %d samples check ok.\n", n);
+        
+        /* check the calls */
+        if ((gs_bus.calls != 1) || (gs_bus.reads != n) || (gs_bus.errors != 0))
+        {
+            as5600_interface_debug_print("as5600: check calls error.\n");
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        as5600_interface_debug_print("as5600: burst used %d reads in %d call, single reads need %d calls.\n",
+                                     gs_bus.reads, gs_bus.calls, n);
+    }
+    
+    /* check the chunks */
+    raw = (uint16_t *)malloc(sizeof(uint16_t) * (AS5600_BURST_TEST_CHUNK + 2));
+    if (raw == NULL)
+    {
+        as5600_interface_debug_print("as5600: malloc failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_bus.angle = 0;
+    gs_bus.step = 1;
+    gs_bus.calls = 0;
+    gs_bus.reads = 0;
+    gs_bus.errors = 0;
+    res = as5600_read_burst(&gs_handle, raw, AS5600_BURST_TEST_CHUNK + 2);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: read burst failed.\n");
+        free(raw);
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = (uint8_t)((gs_bus.calls == 2) && (gs_bus.reads == AS5600_BURST_TEST_CHUNK + 2) && (gs_bus.errors == 0) &&
+                    (raw[AS5600_BURST_TEST_CHUNK] == (AS5600_BURST_TEST_CHUNK & 0xFFF)) &&
+                    (raw[AS5600_BURST_TEST_CHUNK + 1] == ((AS5600_BURST_TEST_CHUNK + 1) & 0xFFF)));
+    free(raw);
+    as5600_interface_debug_print("as5600: check %d samples in 2 calls %s.\n", AS5600_BURST_TEST_CHUNK + 2, (res != 0) ? "ok" : "error");
+    if (res == 0)
+    {
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* check the missing link */
+    gs_handle.iic_read_repeat = NULL;
+    res = as5600_read_burst(&gs_handle, gs_raw, 1);
+    as5600_interface_debug_print("as5600: check missing iic_read_repeat %s.\n", (res == 4) ? "ok" : "error");
+    if (res != 4)
+    {
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* finish burst test */
+    as5600_interface_debug_print("as5600: finish burst test.\n");
+    (void)as5600_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -58,7 +58,12 @@ uint8_t as5600_read_test(uint32_t times)
     DRIVER_AS5600_LINK_IIC_DEINIT(&gs_handle, as5600_interface_iic_deinit);
     DRIVER_AS5600_LINK_IIC_READ(&gs_handle, as5600_interface_iic_read);
     DRIVER_AS5600_LINK_IIC_WRITE(&gs_handle, as5600_interface_iic_write);
+    DRIVER_AS5600_LINK_IIC_READ_CMD(&gs_handle, as5600_interface_iic_read_cmd);
+    DRIVER_AS5600_LINK_IIC_READ_REPEAT(&gs_handle, as5600_interface_iic_read_repeat);
+    DRIVER_AS5600_LINK_IIC_READ_ASYNC(&gs_handle, as5600_interface_iic_read_async);
     DRIVER_AS5600_LINK_DELAY_MS(&gs_handle, as5600_interface_delay_ms);
+    DRIVER_AS5600_LINK_TIMESTAMP_US(&gs_handle, as5600_interface_timestamp_us);
+    DRIVER_AS5600_LINK_DELAY_US(&gs_handle, as5600_interface_delay_us);
     DRIVER_AS5600_LINK_DEBUG_PRINT(&gs_handle, as5600_interface_debug_print);
     
     /* get chip information */
@@ -95,6 +100,7 @@ uint8_t as5600_read_test(uint32_t times)
     /* start read test */
     as5600_interface_debug_print("as5600: start read test.\n");
     
+#if (AS5600_FLOAT_ENABLE == 1)
     for (i = 0; i < times; i++)
     {
         uint16_t angle_raw;
@@ -116,6 +122,209 @@ uint8_t as5600_read_test(uint32_t times)
         /* delay 1000ms */
         as5600_interface_delay_ms(1000);
     }
+#endif
+    
+    /* start fixed read test */
+    as5600_interface_debug_print("as5600: start fixed read test.\n");
+    
+    for (i = 0; i < times; i++)
+    {
+        uint16_t angle_raw;
+        int32_t deg_q16;
+        int32_t turn_q15;
+        int32_t bam16;
+        uint32_t timestamp;
+        
+        /* read data */
+        res = as5600_read_fixed(&gs_handle, AS5600_FIXED_FORMAT_DEG_Q16, &angle_raw, &deg_q16);
+        if (res != 0)
+        {
+            as5600_interface_debug_print("as5600: read fixed failed.\n");
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* convert to the other formats */
+        (void)as5600_angle_convert_to_fixed(&gs_handle, AS5600_FIXED_FORMAT_TURN_Q15, angle_raw, &turn_q15);
+        (void)as5600_angle_convert_to_fixed(&gs_handle, AS5600_FIXED_FORMAT_BAM16, angle_raw, &bam16);
+        
+        /* get the sample timestamp */
+        (void)as5600_get_sample_timestamp(&gs_handle, &timestamp);
+        
+        /* output */
+        as5600_interface_debug_print("as5600: angle is %d.%03d and raw angle is %d.\n", (int)(deg_q16 >> 16), (int)(((deg_q16 & 0xFFFF) * 1000) >> 16), angle_raw);
+        as5600_interface_debug_print("as5600: sample timestamp is %u us.\n", (unsigned int)timestamp);
+        as5600_interface_debug_print("as5600: turn q15 is %d and bam16 is %d.\n", (int)turn_q15, (int)bam16);
+        
+        /* delay 1000ms */
+        as5600_interface_delay_ms(1000);
+    }
+    
+    /* start snapshot test */
+    as5600_interface_debug_print("as5600: start snapshot test.\n");
+    
+    for (i = 0; i < times; i++)
+    {
+        as5600_snapshot_t snapshot;
+        
+        /* read snapshot */
+        res = as5600_read_snapshot(&gs_handle, AS5600_BOOL_TRUE, &snapshot);
+        if (res != 0)
+        {
+            as5600_interface_debug_print("as5600: read snapshot failed.\n");
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        as5600_interface_debug_print("as5600: status is 0x%02X.\n", snapshot.status);
+        as5600_interface_debug_print("as5600: raw angle is %d and angle is %d.\n", snapshot.raw_angle, snapshot.angle);
+        as5600_interface_debug_print("as5600: agc is %d and magnitude is %d.\n", snapshot.agc, snapshot.magnitude);
+        
+        /* delay 1000ms */
+        as5600_interface_delay_ms(1000);
+    }
+    
+    /* start poll read test */
+    as5600_interface_debug_print("as5600: start poll read test.\n");
+    
+    /* start poll read */
+    res = as5600_start_poll_read(&gs_handle, AS5600_POLL_REGISTER_RAW_ANGLE);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: start poll read failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    for (i = 0; i < times; i++)
+    {
+        uint16_t angle_raw;
+        
+        /* poll read */
+        res = as5600_poll_read(&gs_handle, &angle_raw);
+        if (res != 0)
+        {
+            as5600_interface_debug_print("as5600: poll read failed.\n");
+            (void)as5600_stop_poll_read(&gs_handle);
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        as5600_interface_debug_print("as5600: poll raw angle is %d.\n", angle_raw);
+        
+        /* delay 1000ms */
+        as5600_interface_delay_ms(1000);
+    }
+    
+    /* stop poll read */
+    (void)as5600_stop_poll_read(&gs_handle);
+    
+    /* start burst read test */
+    as5600_interface_debug_print("as5600: start burst read test.\n");
+    
+    for (i = 0; i < times; i++)
+    {
+        uint16_t raw[8];
+        
+        /* read burst */
+        res = as5600_read_burst(&gs_handle, raw, 8);
+        if (res != 0)
+        {
+            as5600_interface_debug_print("as5600: read burst failed.\n");
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        as5600_interface_debug_print("as5600: burst raw angle is %d %d %d %d %d %d %d %d.\n",
+                                     raw[0], raw[1], raw[2], raw[3], raw[4], raw[5], raw[6], raw[7]);
+        
+        /* delay 1000ms */
+        as5600_interface_delay_ms(1000);
+    }
+    
+    /* start async read test */
+    as5600_interface_debug_print("as5600: start async read test.\n");
+    
+    for (i = 0; i < times; i++)
+    {
+        uint16_t angle_raw;
+        uint32_t polls;
+        
+        /* start the read */
+        res = as5600_read_start(&gs_handle);
+        if (res != 0)
+        {
+            as5600_interface_debug_print("as5600: read start failed.\n");
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* other work runs here while the transfer is in flight */
+        polls = 0;
+        do
+        {
+            polls++;
+            res = as5600_read_poll(&gs_handle, &angle_raw);
+        } while (res == 4);
+        if (res != 0)
+        {
+            as5600_interface_debug_print("as5600: read poll failed.\n");
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        as5600_interface_debug_print("as5600: async raw angle is %d after %d polls.\n", angle_raw, (int)polls);
+        
+        /* delay 1000ms */
+        as5600_interface_delay_ms(1000);
+    }
+    
+    /* start multi turn test */
+    as5600_interface_debug_print("as5600: start multi turn test.\n");
+    
+    /* multi turn init */
+    res = as5600_multi_turn_init(&gs_handle, 1024);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: multi turn init failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    for (i = 0; i < times; i++)
+    {
+        int64_t position;
+        as5600_bool_t alias;
+        
+        /* multi turn read */
+        res = as5600_multi_turn_read(&gs_handle, &position, &alias);
+        if (res != 0)
+        {
+            as5600_interface_debug_print("as5600: multi turn read failed.\n");
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        as5600_interface_debug_print("as5600: position is %d turns and %d raw%s.\n", (int)(position / 4096), (int)(position % 4096),
+                                     (alias == AS5600_BOOL_TRUE) ? " with alias" : "");
+        
+        /* delay 1000ms */
+        as5600_interface_delay_ms(1000);
+    }
     
     /* finish read test */
     as5600_interface_debug_print("as5600: finish read test.\n");
@@ -57,9 +57,15 @@ uint8_t as5600_register_test(void)
     uint16_t ang;
     uint16_t ang_check;
     uint16_t reg;
+#if (AS5600_FLOAT_ENABLE == 1)
     float deg;
     float deg_check;
+#endif
+    int32_t fixed;
+    int32_t fixed_check;
     as5600_info_t info;
+    as5600_config_t config;
+    as5600_config_t config_check;
     as5600_bool_t enable;
     as5600_power_mode_t mode;
     as5600_slow_filter_t filter;
@@ -74,7 +80,10 @@ uint8_t as5600_register_test(void)
     DRIVER_AS5600_LINK_IIC_DEINIT(&gs_handle, as5600_interface_iic_deinit);
     DRIVER_AS5600_LINK_IIC_READ(&gs_handle, as5600_interface_iic_read);
     DRIVER_AS5600_LINK_IIC_WRITE(&gs_handle, as5600_interface_iic_write);
+    DRIVER_AS5600_LINK_IIC_READ_CMD(&gs_handle, as5600_interface_iic_read_cmd);
     DRIVER_AS5600_LINK_DELAY_MS(&gs_handle, as5600_interface_delay_ms);
+    DRIVER_AS5600_LINK_TIMESTAMP_US(&gs_handle, as5600_interface_timestamp_us);
+    DRIVER_AS5600_LINK_DELAY_US(&gs_handle, as5600_interface_delay_us);
     DRIVER_AS5600_LINK_DEBUG_PRINT(&gs_handle, as5600_interface_debug_print);
     
     /* get chip information */
@@ -180,6 +189,38 @@ uint8_t as5600_register_test(void)
     }
     as5600_interface_debug_print("as5600: check max angle %s.\n", (ang_check == ang) ? "ok" : "error");
     
+    /* as5600_set_output_range test */
+    as5600_interface_debug_print("as5600: as5600_set_output_range test.\n");
+    
+    pos = 2048;
+    res = as5600_set_output_range(&gs_handle, 0, pos, 0);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: set output range failed.\n");
+        (void)as5600_deinit(&gs_handle);
+       
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: set output range 0 to %d.\n", pos);
+    res = as5600_get_stop_position(&gs_handle, &pos_check);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: get stop position failed.\n");
+        (void)as5600_deinit(&gs_handle);
+       
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: check output range %s.\n", (pos_check == pos) ? "ok" : "error");
+    res = as5600_set_output_range(&gs_handle, 0, 0, 0);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: set output range failed.\n");
+        (void)as5600_deinit(&gs_handle);
+       
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: clear output range.\n");
+    
     /* as5600_set_watch_dog/as5600_get_watch_dog test */
     as5600_interface_debug_print("as5600: as5600_set_watch_dog/as5600_get_watch_dog test.\n");
     
@@ -851,6 +892,7 @@ uint8_t as5600_register_test(void)
     }
     as5600_interface_debug_print("as5600: get magnitude %d.\n", magnitude);
     
+#if (AS5600_FLOAT_ENABLE == 1)
     /* as5600_angle_convert_to_data test */
     as5600_interface_debug_print("as5600: as5600_angle_convert_to_register/as5600_angle_convert_to_data test.\n");
     
@@ -880,6 +922,266 @@ uint8_t as5600_register_test(void)
         return 1;
     }
     as5600_interface_debug_print("as5600: check angle %0.2f.\n", deg_check);
+#endif
+    
+    /* as5600_angle_convert_from_fixed/as5600_angle_convert_to_fixed test */
+    as5600_interface_debug_print("as5600: as5600_angle_convert_from_fixed/as5600_angle_convert_to_fixed test.\n");
+    
+    /* set the degrees in q16.16 */
+    fixed = (int32_t)(rand() % 4096) * 5760;
+    
+    /* convert to register */
+    res = as5600_angle_convert_from_fixed(&gs_handle, AS5600_FIXED_FORMAT_DEG_Q16, fixed, &reg);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: angle convert from fixed failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    as5600_interface_debug_print("as5600: set angle q16 %d.\n", (int)fixed);
+    
+    /* convert to fixed */
+    res = as5600_angle_convert_to_fixed(&gs_handle, AS5600_FIXED_FORMAT_DEG_Q16, reg, &fixed_check);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: angle convert to fixed failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: check angle q16 %s.\n", (fixed_check == fixed) ? "ok" : "error");
+    
+    /* set the turns in q1.15 */
+    fixed = (int32_t)(rand() % 4096) << 3;
+    
+    /* convert to register */
+    res = as5600_angle_convert_from_fixed(&gs_handle, AS5600_FIXED_FORMAT_TURN_Q15, fixed, &reg);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: angle convert from fixed failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    as5600_interface_debug_print("as5600: set turn q15 %d.\n", (int)fixed);
+    
+    /* convert to fixed */
+    res = as5600_angle_convert_to_fixed(&gs_handle, AS5600_FIXED_FORMAT_TURN_Q15, reg, &fixed_check);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: angle convert to fixed failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: check turn q15 %s.\n", (fixed_check == fixed) ? "ok" : "error");
+    
+    /* set the binary angle */
+    fixed = (int32_t)(rand() % 4096) << 4;
+    
+    /* convert to register */
+    res = as5600_angle_convert_from_fixed(&gs_handle, AS5600_FIXED_FORMAT_BAM16, fixed, &reg);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: angle convert from fixed failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* output */
+    as5600_interface_debug_print("as5600: set bam16 %d.\n", (int)fixed);
+    
+    /* convert to fixed */
+    res = as5600_angle_convert_to_fixed(&gs_handle, AS5600_FIXED_FORMAT_BAM16, reg, &fixed_check);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: angle convert to fixed failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: check bam16 %s.\n", (fixed_check == fixed) ? "ok" : "error");
+    
+    /* as5600_set_shadow_cache/as5600_get_shadow_cache test */
+    as5600_interface_debug_print("as5600: as5600_set_shadow_cache/as5600_get_shadow_cache test.\n");
+    
+    /* enable shadow cache */
+    res = as5600_set_shadow_cache(&gs_handle, AS5600_BOOL_TRUE);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: set shadow cache failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: enable shadow cache.\n");
+    res = as5600_get_shadow_cache(&gs_handle, &enable);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: get shadow cache failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: check shadow cache %s.\n", (enable == AS5600_BOOL_TRUE) ? "ok" : "error");
+    
+    /* as5600_shadow_cache_refresh test */
+    as5600_interface_debug_print("as5600: as5600_shadow_cache_refresh test.\n");
+    
+    /* refresh shadow cache */
+    res = as5600_shadow_cache_refresh(&gs_handle);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: shadow cache refresh failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: refresh shadow cache.\n");
+    
+    /* set the cached start position */
+    pos = rand() % 0xFFF;
+    res = as5600_set_start_position(&gs_handle, pos);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: set start position failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: set start position %d.\n", pos);
+    
+    /* set the cached slow filter */
+    res = as5600_set_slow_filter(&gs_handle, AS5600_SLOW_FILTER_4X);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: set slow filter failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: set slow filter 4x.\n");
+    
+    /* as5600_shadow_cache_invalidate test */
+    as5600_interface_debug_print("as5600: as5600_shadow_cache_invalidate test.\n");
+    
+    /* invalidate shadow cache */
+    res = as5600_shadow_cache_invalidate(&gs_handle);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: shadow cache invalidate failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: invalidate shadow cache.\n");
+    
+    /* reload from the chip */
+    res = as5600_get_start_position(&gs_handle, &pos_check);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: get start position failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: check start position %s.\n", (pos_check == pos) ? "ok" : "error");
+    res = as5600_get_slow_filter(&gs_handle, &filter);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: get slow filter failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: check slow filter %s.\n", (filter == AS5600_SLOW_FILTER_4X) ? "ok" : "error");
+    
+    /* disable shadow cache */
+    res = as5600_set_shadow_cache(&gs_handle, AS5600_BOOL_FALSE);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: set shadow cache failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: disable shadow cache.\n");
+    
+    /* as5600_apply_config/as5600_get_config test */
+    as5600_interface_debug_print("as5600: as5600_apply_config/as5600_get_config test.\n");
+    
+    /* get the current config */
+    res = as5600_get_config(&gs_handle, &config);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: get config failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* apply the whole config */
+    config.start_position = rand() % 0xFFF;
+    config.stop_position = rand() % 0xFFF;
+    config.max_angle = rand() % 0xFFF;
+    config.slow_filter = AS5600_SLOW_FILTER_8X;
+    config.hysteresis = AS5600_HYSTERESIS_1LSB;
+    res = as5600_apply_config(&gs_handle, &config, AS5600_BOOL_FALSE);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: apply config failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: apply config.\n");
+    res = as5600_get_config(&gs_handle, &config_check);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: get config failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: check start position %s.\n", (config_check.start_position == config.start_position) ? "ok" : "error");
+    as5600_interface_debug_print("as5600: check stop position %s.\n", (config_check.stop_position == config.stop_position) ? "ok" : "error");
+    as5600_interface_debug_print("as5600: check max angle %s.\n", (config_check.max_angle == config.max_angle) ? "ok" : "error");
+    as5600_interface_debug_print("as5600: check slow filter %s.\n", (config_check.slow_filter == config.slow_filter) ? "ok" : "error");
+    as5600_interface_debug_print("as5600: check hysteresis %s.\n", (config_check.hysteresis == config.hysteresis) ? "ok" : "error");
+    as5600_interface_debug_print("as5600: check power mode %s.\n", (config_check.power_mode == config.power_mode) ? "ok" : "error");
+    
+    /* apply only the changed bytes */
+    config.max_angle = rand() % 0xFFF;
+    config.power_mode = AS5600_POWER_MODE_NOM;
+    res = as5600_apply_config(&gs_handle, &config, AS5600_BOOL_TRUE);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: apply config failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: apply config diff.\n");
+    res = as5600_get_config(&gs_handle, &config_check);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: get config failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: check start position %s.\n", (config_check.start_position == config.start_position) ? "ok" : "error");
+    as5600_interface_debug_print("as5600: check stop position %s.\n", (config_check.stop_position == config.stop_position) ? "ok" : "error");
+    as5600_interface_debug_print("as5600: check max angle %s.\n", (config_check.max_angle == config.max_angle) ? "ok" : "error");
+    as5600_interface_debug_print("as5600: check slow filter %s.\n", (config_check.slow_filter == config.slow_filter) ? "ok" : "error");
+    as5600_interface_debug_print("as5600: check hysteresis %s.\n", (config_check.hysteresis == config.hysteresis) ? "ok" : "error");
+    as5600_interface_debug_print("as5600: check power mode %s.\n", (config_check.power_mode == config.power_mode) ? "ok" : "error");
     
     /* finish register test */
     as5600_interface_debug_print("as5600: finish register test.\n");
@@ -0,0 +1,558 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_as5600_sim.c
+ * @brief     driver as5600 sim source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-09-30
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/09/30  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+ 
+#include "driver_as5600_sim.h"
+
+/**
+ * @brief register map definition
+ */
+#define AS5600_SIM_REG_ZMCO             0x00        /**< written times register */
+#define AS5600_SIM_REG_ZPOS_H           0x01        /**< start position register high */
+#define AS5600_SIM_REG_CONF_L           0x08        /**< conf register low */
+#define AS5600_SIM_REG_STATUS           0x0B        /**< status register */
+#define AS5600_SIM_REG_RAW_ANGLE_H      0x0C        /**< raw angle register high */
+#define AS5600_SIM_REG_ANGLE_H          0x0E        /**< angle register high */
+#define AS5600_SIM_REG_AGC              0x1A        /**< automatic gain control register */
+#define AS5600_SIM_REG_MAGNITUDE_H      0x1B        /**< magnitude register high */
+#define AS5600_SIM_REG_BURN             0xFF        /**< burn register */
+
+/**
+ * @brief writable bits of the registers from 0x01 to 0x08
+ */
+static const uint8_t gs_write_mask[8] =
+{
+    0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x3F, 0xFF,
+};
+
+/**
+ * @brief     get a 12 bits register value
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @param[in] reg high byte register address
+ * @return    register value
+ * @note      none
+ */
+static uint16_t a_as5600_sim_get12(as5600_sim_t *sim, uint8_t reg)
+{
+    return (uint16_t)(((sim->reg[reg] & 0x0F) << 8) | sim->reg[reg + 1]);
+}
+
+/**
+ * @brief     set a 12 bits register value
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @param[in] reg high byte register address
+ * @param[in] value register value
+ * @note      none
+ */
+static void a_as5600_sim_set12(as5600_sim_t *sim, uint8_t reg, uint16_t value)
+{
+    sim->reg[reg] = (uint8_t)((value >> 8) & 0x0F);
+    sim->reg[reg + 1] = (uint8_t)(value & 0xFF);
+}
+
+/**
+ * @brief     update the output registers
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @note      the angle is scaled from the start position over the max angle,
+ *            or over the stop position when the max angle is 0,
+ *            out of range positions are clamped to the nearer end
+ */
+static void a_as5600_sim_update(as5600_sim_t *sim)
+{
+    uint16_t zpos;
+    uint16_t mpos;
+    uint16_t mang;
+    uint32_t range;
+    uint32_t delta;
+    uint32_t angle;
+    uint8_t agc;
+    
+    /* get the range */
+    zpos = a_as5600_sim_get12(sim, 0x01);
+    mpos = a_as5600_sim_get12(sim, 0x03);
+    mang = a_as5600_sim_get12(sim, 0x05);
+    if (mang != 0)
+    {
+        range = mang;
+    }
+    else if (mpos != 0)
+    {
+        range = (uint32_t)((mpos - zpos) & 0xFFF);
+    }
+    else
+    {
+        range = 0;
+    }
+    
+    /* scale the angle */
+    delta = (uint32_t)((sim->raw_angle - zpos) & 0xFFF);
+    if (range == 0)
+    {
+        angle = delta;
+    }
+    else if (delta > range)
+    {
+        angle = ((delta - range) < (4096 - delta)) ? 4095 : 0;
+    }
+    else
+    {
+        angle = (delta * 4096) / range;
+        angle = (angle > 4095) ? 4095 : angle;
+    }
+    a_as5600_sim_set12(sim, AS5600_SIM_REG_RAW_ANGLE_H, sim->raw_angle);
+    a_as5600_sim_set12(sim, AS5600_SIM_REG_ANGLE_H, (uint16_t)angle);
+    
+    /* set the status */
+    agc = sim->reg[AS5600_SIM_REG_AGC];
+    sim->reg[AS5600_SIM_REG_STATUS] = 0;
+    if (sim->detected != 0)
+    {
+        sim->reg[AS5600_SIM_REG_STATUS] |= AS5600_STATUS_MD;
+        if (agc == 255)
+        {
+            sim->reg[AS5600_SIM_REG_STATUS] |= AS5600_STATUS_ML;
+        }
+        if (agc == 0)
+        {
+            sim->reg[AS5600_SIM_REG_STATUS] |= AS5600_STATUS_MH;
+        }
+    }
+    else
+    {
+        sim->reg[AS5600_SIM_REG_STATUS] |= AS5600_STATUS_ML;
+    }
+}
+
+/**
+ * @brief     run a burn command
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @param[in] cmd burn command
+ * @note      burn angle needs a magnet and at most 3 times,
+ *            burn setting needs a never burned chip
+ */
+static void a_as5600_sim_burn(as5600_sim_t *sim, uint8_t cmd)
+{
+    uint8_t zmco;
+    
+    zmco = sim->reg[AS5600_SIM_REG_ZMCO] & 0x03;
+    if (cmd == AS5600_BURN_ANGLE)
+    {
+        if ((sim->detected != 0) && (zmco < 3))
+        {
+            sim->otp[0] = sim->reg[0x01];
+            sim->otp[1] = sim->reg[0x02];
+            sim->otp[2] = sim->reg[0x03];
+            sim->otp[3] = sim->reg[0x04];
+            sim->reg[AS5600_SIM_REG_ZMCO] = (uint8_t)(zmco + 1);
+        }
+    }
+    else if (cmd == AS5600_BURN_SETTING)
+    {
+        if (zmco == 0)
+        {
+            sim->otp[4] = sim->reg[0x05];
+            sim->otp[5] = sim->reg[0x06];
+            sim->otp[6] = sim->reg[0x07];
+            sim->otp[7] = sim->reg[0x08];
+        }
+    }
+    else if ((cmd == AS5600_BURN_CMD1) || (cmd == AS5600_BURN_CMD2) || (cmd == AS5600_BURN_CMD3))
+    {
+        uint8_t i;
+        
+        /* load the otp content */
+        for (i = 0; i < 8; i++)
+        {
+            sim->reg[AS5600_SIM_REG_ZPOS_H + i] = sim->otp[i];
+        }
+        a_as5600_sim_update(sim);
+    }
+    else
+    {
+        /* ignore unknown commands */
+    }
+}
+
+/**
+ * @brief      read bytes from the address pointer
+ * @param[in]  *sim pointer to an as5600 sim structure
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @note       when the pointer starts at the high byte of the raw angle, angle or magnitude register,
+ *             it returns to the high byte after the low byte is read, a pending glitch hits the first byte
+ */
+static void a_as5600_sim_read_bytes(as5600_sim_t *sim, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    uint8_t start;
+    uint8_t wrap;
+    
+    start = sim->pointer;
+    wrap = (uint8_t)((start == AS5600_SIM_REG_RAW_ANGLE_H) ||
+                     (start == AS5600_SIM_REG_ANGLE_H) ||
+                     (start == AS5600_SIM_REG_MAGNITUDE_H));
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = (sim->pointer == AS5600_SIM_REG_BURN) ? 0 : sim->reg[sim->pointer];
+        if ((wrap != 0) && (sim->pointer != start))
+        {
+            sim->pointer = start;
+        }
+        else
+        {
+            sim->pointer++;
+        }
+    }
+    if ((sim->glitch != 0) && (len != 0))
+    {
+        buf[0] ^= sim->glitch;
+        sim->glitch = 0;
+    }
+}
+
+/**
+ * @brief     reset the sim to the power on state
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @note      the magnet is detected at angle 0 with a mid range agc
+ */
+void as5600_sim_reset(as5600_sim_t *sim)
+{
+    memset(sim, 0, sizeof(as5600_sim_t));
+    sim->detected = 1;
+    sim->reg[AS5600_SIM_REG_AGC] = 128;
+    a_as5600_sim_set12(sim, AS5600_SIM_REG_MAGNITUDE_H, 2048);
+    a_as5600_sim_update(sim);
+}
+
+/**
+ * @brief     set the magnet raw angle
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @param[in] raw raw angle
+ * @note      the raw angle, angle and status registers are updated
+ */
+void as5600_sim_set_raw_angle(as5600_sim_t *sim, uint16_t raw)
+{
+    sim->raw_angle = raw & 0xFFF;
+    a_as5600_sim_update(sim);
+}
+
+/**
+ * @brief     set the magnet field
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @param[in] detected magnet detected flag
+ * @param[in] agc automatic gain control value
+ * @param[in] magnitude cordic magnitude
+ * @note      agc 255 sets the ml bit and agc 0 sets the mh bit
+ */
+void as5600_sim_set_magnet(as5600_sim_t *sim, uint8_t detected, uint8_t agc, uint16_t magnitude)
+{
+    sim->detected = detected;
+    sim->reg[AS5600_SIM_REG_AGC] = agc;
+    a_as5600_sim_set12(sim, AS5600_SIM_REG_MAGNITUDE_H, magnitude);
+    a_as5600_sim_update(sim);
+}
+
+/**
+ * @brief     corrupt the next read
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @param[in] mask xor mask of the first byte
+ * @note      models a torn or noisy read, only one read is hit
+ */
+void as5600_sim_set_glitch(as5600_sim_t *sim, uint8_t mask)
+{
+    sim->glitch = mask;
+}
+
+/**
+ * @brief     clear the bus counters
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @note      none
+ */
+void as5600_sim_clear_counter(as5600_sim_t *sim)
+{
+    sim->transfers = 0;
+    sim->msgs = 0;
+    sim->bytes = 0;
+}
+
+/**
+ * @brief      init a bus timing with the iic specification minimums
+ * @param[out] *timing pointer to an as5600 sim timing structure
+ * @param[in]  scl_hz scl frequency in Hz
+ * @note       up to 100kHz uses the standard mode times, up to 400kHz the fast mode times
+ *             and above the fast mode plus times, the clock stretching is 0
+ */
+void as5600_sim_timing_init(as5600_sim_timing_t *timing, uint32_t scl_hz)
+{
+    timing->scl_hz = scl_hz;
+    if (scl_hz <= 100000)
+    {
+        timing->t_hd_sta_ns = 4000;
+        timing->t_su_sta_ns = 4700;
+        timing->t_su_sto_ns = 4000;
+        timing->t_buf_ns = 4700;
+    }
+    else if (scl_hz <= 400000)
+    {
+        timing->t_hd_sta_ns = 600;
+        timing->t_su_sta_ns = 600;
+        timing->t_su_sto_ns = 600;
+        timing->t_buf_ns = 1300;
+    }
+    else
+    {
+        timing->t_hd_sta_ns = 260;
+        timing->t_su_sta_ns = 260;
+        timing->t_su_sto_ns = 260;
+        timing->t_buf_ns = 500;
+    }
+    timing->t_stretch_ns = 0;
+}
+
+/**
+ * @brief     project the counted bus traffic to the wire time
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @param[in] *timing pointer to an as5600 sim timing structure
+ * @return    wire time in ns
+ * @note      every byte takes 9 scl clocks with the ack, every transfer takes a start,
+ *            a stop and the bus free time and every further message takes a repeated start
+ */
+uint64_t as5600_sim_get_wire_time(as5600_sim_t *sim, const as5600_sim_timing_t *timing)
+{
+    uint64_t ns;
+    
+    ns = ((uint64_t)sim->bytes * 9 * 1000000000ULL) / timing->scl_hz;
+    ns += (uint64_t)sim->bytes * timing->t_stretch_ns;
+    ns += (uint64_t)sim->transfers * (timing->t_hd_sta_ns + timing->t_su_sto_ns + timing->t_buf_ns);
+    ns += (uint64_t)(sim->msgs - sim->transfers) * (timing->t_su_sta_ns + timing->t_hd_sta_ns);
+    
+    return ns;
+}
+
+/**
+ * @brief     link the sim to an as5600 handle
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @note      the iic link functions and the user data are linked,
+ *            delay_ms and debug_print must be linked by the caller
+ */
+void as5600_sim_link(as5600_handle_t *handle, as5600_sim_t *sim)
+{
+    DRIVER_AS5600_LINK_USER_DATA(handle, sim);
+    DRIVER_AS5600_LINK_IIC_INIT_EX(handle, as5600_sim_iic_init);
+    DRIVER_AS5600_LINK_IIC_DEINIT_EX(handle, as5600_sim_iic_deinit);
+    DRIVER_AS5600_LINK_IIC_READ_EX(handle, as5600_sim_iic_read);
+    DRIVER_AS5600_LINK_IIC_WRITE_EX(handle, as5600_sim_iic_write);
+    DRIVER_AS5600_LINK_IIC_READ_CMD_EX(handle, as5600_sim_iic_read_cmd);
+    DRIVER_AS5600_LINK_IIC_READ_REPEAT(handle, as5600_sim_iic_read_repeat);
+}
+
+/**
+ * @brief     sim iic bus init
+ * @param[in] *user_data pointer to an as5600 sim structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t as5600_sim_iic_init(void *user_data)
+{
+    (void)user_data;
+    
+    return 0;
+}
+
+/**
+ * @brief     sim iic bus deinit
+ * @param[in] *user_data pointer to an as5600 sim structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t as5600_sim_iic_deinit(void *user_data)
+{
+    (void)user_data;
+    
+    return 0;
+}
+
+/**
+ * @brief      sim iic bus read
+ * @param[in]  *user_data pointer to an as5600 sim structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_sim_iic_read(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    as5600_sim_t *sim = (as5600_sim_t *)user_data;
+    
+    if (addr != AS5600_SIM_ADDRESS)
+    {
+        return 1;
+    }
+    sim->transfers += 1;
+    sim->msgs += 2;
+    sim->bytes += 2 + 1 + (uint32_t)len;
+    sim->pointer = reg;
+    a_as5600_sim_read_bytes(sim, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief     sim iic bus write
+ * @param[in] *user_data pointer to an as5600 sim structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t as5600_sim_iic_write(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    as5600_sim_t *sim = (as5600_sim_t *)user_data;
+    uint16_t i;
+    uint8_t update;
+    
+    if (addr != AS5600_SIM_ADDRESS)
+    {
+        return 1;
+    }
+    sim->transfers += 1;
+    sim->msgs += 1;
+    sim->bytes += 1 + 1 + (uint32_t)len;
+    sim->pointer = reg;
+    update = 0;
+    for (i = 0; i < len; i++)
+    {
+        uint8_t p = sim->pointer;
+        
+        if ((p >= AS5600_SIM_REG_ZPOS_H) && (p <= AS5600_SIM_REG_CONF_L))
+        {
+            uint8_t mask = gs_write_mask[p - AS5600_SIM_REG_ZPOS_H];
+            
+            if (((buf[i] ^ sim->reg[p]) & (uint8_t)(~mask)) != 0)
+            {
+                sim->reserved += 1;
+            }
+            sim->reg[p] = (uint8_t)((sim->reg[p] & (uint8_t)(~mask)) | (buf[i] & mask));
+            update = 1;
+        }
+        else if (p == AS5600_SIM_REG_BURN)
+        {
+            a_as5600_sim_burn(sim, buf[i]);
+        }
+        else
+        {
+            /* read only registers ignore the data */
+        }
+        sim->pointer++;
+    }
+    if (update != 0)
+    {
+        a_as5600_sim_update(sim);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      sim iic bus read command
+ * @param[in]  *user_data pointer to an as5600 sim structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       reads from the current address pointer
+ */
+uint8_t as5600_sim_iic_read_cmd(void *user_data, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    as5600_sim_t *sim = (as5600_sim_t *)user_data;
+    
+    if (addr != AS5600_SIM_ADDRESS)
+    {
+        return 1;
+    }
+    sim->transfers += 1;
+    sim->msgs += 1;
+    sim->bytes += 1 + (uint32_t)len;
+    a_as5600_sim_read_bytes(sim, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief      sim iic bus repeated read
+ * @param[in]  *user_data pointer to an as5600 sim structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of one read
+ * @param[in]  num read times
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       counted as one register write and num reads
+ */
+uint8_t as5600_sim_iic_read_repeat(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    as5600_sim_t *sim = (as5600_sim_t *)user_data;
+    uint16_t i;
+    
+    if (addr != AS5600_SIM_ADDRESS)
+    {
+        return 1;
+    }
+    sim->transfers += 1;
+    sim->msgs += 1 + (uint32_t)num;
+    sim->bytes += 2 + (uint32_t)num * (1 + (uint32_t)len);
+    sim->pointer = reg;
+    for (i = 0; i < num; i++)
+    {
+        a_as5600_sim_read_bytes(sim, buf + (uint32_t)i * len, len);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_as5600_sim.h
+ * @brief     driver as5600 sim header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-09-30
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/09/30  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_AS5600_SIM_H
+#define DRIVER_AS5600_SIM_H
+
+#include "driver_as5600.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup as5600_sim as5600 sim function
+ * @brief    as5600 software device model
+ * @ingroup  as5600_test_driver
+ * @{
+ */
+
+/**
+ * @brief as5600 sim iic address definition
+ */
+#define AS5600_SIM_ADDRESS 0x6C        /**< iic device write address */
+
+/**
+ * @brief as5600 sim structure definition
+ */
+typedef struct as5600_sim_s
+{
+    uint8_t reg[256];             /**< register file */
+    uint8_t otp[8];               /**< otp copy of the zpos, mpos, mang and conf registers */
+    uint8_t pointer;              /**< address pointer */
+    uint8_t detected;             /**< magnet detected flag */
+    uint16_t raw_angle;           /**< magnet raw angle */
+    uint32_t transfers;           /**< iic transfer counter */
+    uint32_t msgs;                /**< iic message counter */
+    uint32_t bytes;               /**< iic bytes on the wire counter, address bytes included */
+    uint8_t glitch;               /**< xor mask of the first byte of the next read */
+    uint32_t reserved;            /**< writes that tried to change a read only reserved bit */
+} as5600_sim_t;
+
+/**
+ * @brief as5600 sim bus timing structure definition
+ */
+typedef struct as5600_sim_timing_s
+{
+    uint32_t scl_hz;              /**< scl frequency in Hz */
+    uint32_t t_hd_sta_ns;         /**< start hold time in ns */
+    uint32_t t_su_sta_ns;         /**< repeated start setup time in ns */
+    uint32_t t_su_sto_ns;         /**< stop setup time in ns */
+    uint32_t t_buf_ns;            /**< bus free time between a stop and the next start in ns */
+    uint32_t t_stretch_ns;        /**< clock stretching per byte in ns */
+} as5600_sim_timing_t;
+
+/**
+ * @brief     reset the sim to the power on state
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @note      the magnet is detected at angle 0 with a mid range agc
+ */
+void as5600_sim_reset(as5600_sim_t *sim);
+
+/**
+ * @brief     set the magnet raw angle
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @param[in] raw raw angle
+ * @note      the raw angle, angle and status registers are updated
+ */
+void as5600_sim_set_raw_angle(as5600_sim_t *sim, uint16_t raw);
+
+/**
+ * @brief     set the magnet field
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @param[in] detected magnet detected flag
+ * @param[in] agc automatic gain control value
+ * @param[in] magnitude cordic magnitude
+ * @note      agc 255 sets the ml bit and agc 0 sets the mh bit
+ */
+void as5600_sim_set_magnet(as5600_sim_t *sim, uint8_t detected, uint8_t agc, uint16_t magnitude);
+
+/**
+ * @brief     corrupt the next read
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @param[in] mask xor mask of the first byte
+ * @note      models a torn or noisy read, only one read is hit
+ */
+void as5600_sim_set_glitch(as5600_sim_t *sim, uint8_t mask);
+
+/**
+ * @brief     clear the bus counters
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @note      none
+ */
+void as5600_sim_clear_counter(as5600_sim_t *sim);
+
+/**
+ * @brief      init a bus timing with the iic specification minimums
+ * @param[out] *timing pointer to an as5600 sim timing structure
+ * @param[in]  scl_hz scl frequency in Hz
+ * @note       up to 100kHz uses the standard mode times, up to 400kHz the fast mode times
+ *             and above the fast mode plus times, the clock stretching is 0
+ */
+void as5600_sim_timing_init(as5600_sim_timing_t *timing, uint32_t scl_hz);
+
+/**
+ * @brief     project the counted bus traffic to the wire time
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @param[in] *timing pointer to an as5600 sim timing structure
+ * @return    wire time in ns
+ * @note      every byte takes 9 scl clocks with the ack, every transfer takes a start,
+ *            a stop and the bus free time and every further message takes a repeated start
+ */
+uint64_t as5600_sim_get_wire_time(as5600_sim_t *sim, const as5600_sim_timing_t *timing);
+
+/**
+ * @brief     link the sim to an as5600 handle
+ * @param[in] *handle pointer to an as5600 handle structure
+ * @param[in] *sim pointer to an as5600 sim structure
+ * @note      the iic link functions and the user data are linked,
+ *            delay_ms and debug_print must be linked by the caller
+ */
+void as5600_sim_link(as5600_handle_t *handle, as5600_sim_t *sim);
+
+/**
+ * @brief     sim iic bus init
+ * @param[in] *user_data pointer to an as5600 sim structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t as5600_sim_iic_init(void *user_data);
+
+/**
+ * @brief     sim iic bus deinit
+ * @param[in] *user_data pointer to an as5600 sim structure
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t as5600_sim_iic_deinit(void *user_data);
+
+/**
+ * @brief      sim iic bus read
+ * @param[in]  *user_data pointer to an as5600 sim structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t as5600_sim_iic_read(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     sim iic bus write
+ * @param[in] *user_data pointer to an as5600 sim structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t as5600_sim_iic_write(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      sim iic bus read command
+ * @param[in]  *user_data pointer to an as5600 sim structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       reads from the current address pointer
+ */
+uint8_t as5600_sim_iic_read_cmd(void *user_data, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      sim iic bus repeated read
+ * @param[in]  *user_data pointer to an as5600 sim structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of one read
+ * @param[in]  num read times
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       counted as one register write and num reads
+ */
+uint8_t as5600_sim_iic_read_repeat(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, uint16_t num);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
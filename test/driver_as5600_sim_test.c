@@ -0,0 +1,844 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_as5600_sim_test.c
+ * @brief     driver as5600 sim test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-09-30
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/09/30  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+ 
+#include "driver_as5600_sim_test.h"
+#include "driver_as5600_sim.h"
+#include <stdlib.h>
+
+static as5600_handle_t gs_handle;        /**< as5600 handle */
+static as5600_sim_t gs_sim;              /**< as5600 sim */
+
+/**
+ * @brief     print the check result
+ * @param[in] *name pointer to a check name
+ * @param[in] ok check result
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_as5600_sim_check(const char *name, uint8_t ok)
+{
+    as5600_interface_debug_print("as5600: check %s %s.\n", name, (ok != 0) ? "ok" : "error");
+    if (ok == 0)
+    {
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     sim async read, completed before it returns
+ * @param[in] *user_data pointer to an as5600 sim structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] *done pointer to a completion function
+ * @param[in] *ctx pointer to a completion context
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_as5600_sim_read_async(void *user_data, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                       void (*done)(void *ctx, uint8_t res), void *ctx)
+{
+    done(ctx, as5600_sim_iic_read(user_data, addr, reg, buf, len));
+    
+    return 0;
+}
+
+/**
+ * @brief     sim test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the test runs on the software device model and needs no chip
+ */
+uint8_t as5600_sim_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t status;
+    uint8_t agc;
+    uint8_t zmco;
+    uint8_t reg;
+    uint16_t raw;
+    uint16_t angle;
+    uint16_t magnitude;
+    uint16_t pos;
+    uint16_t data[16];
+    uint32_t i;
+    uint32_t msgs;
+    as5600_config_t config;
+    as5600_config_t config_check;
+    as5600_field_value_t fields[4];
+    as5600_snapshot_t snapshot;
+    as5600_sim_timing_t timing;
+    uint32_t before;
+    uint32_t after;
+    uint32_t stamp;
+    uint32_t count;
+    uint32_t dropped;
+    int32_t fixed;
+    int64_t unwrap[5];
+    int64_t position;
+    uint16_t last_raw;
+    as5600_ring_t ring;
+    as5600_sample_t ring_buf[4];
+    as5600_sample_t sample;
+    as5600_sample_t decoded;
+    uint16_t sequence;
+    uint8_t frame[AS5600_STREAM_FRAME_SIZE];
+#if (AS5600_STATS_ENABLE == 1)
+    as5600_stats_t stats;
+#endif
+#if (AS5600_FLOAT_ENABLE == 1)
+    float deg;
+#endif
+    
+    /* link interface function */
+    DRIVER_AS5600_LINK_INIT(&gs_handle, as5600_handle_t);
+    as5600_sim_reset(&gs_sim);
+    as5600_sim_link(&gs_handle, &gs_sim);
+    DRIVER_AS5600_LINK_DELAY_MS(&gs_handle, as5600_interface_delay_ms);
+    DRIVER_AS5600_LINK_TIMESTAMP_US(&gs_handle, as5600_interface_timestamp_us);
+    DRIVER_AS5600_LINK_DELAY_US(&gs_handle, as5600_interface_delay_us);
+    DRIVER_AS5600_LINK_DEBUG_PRINT(&gs_handle, as5600_interface_debug_print);
+    
+    /* as5600 init */
+    res = as5600_init(&gs_handle);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* start sim test */
+    as5600_interface_debug_print("as5600: start sim test.\n");
+    
+    /* raw angle and angle without a range */
+    as5600_interface_debug_print("as5600: as5600_get_raw_angle/as5600_get_angle test.\n");
+    for (i = 0; i < times; i++)
+    {
+        uint16_t set = (uint16_t)(rand() % 4096);
+        
+        as5600_sim_set_raw_angle(&gs_sim, set);
+        res = as5600_get_raw_angle(&gs_handle, &raw);
+        res |= as5600_get_angle(&gs_handle, &angle);
+        if (res != 0)
+        {
+            as5600_interface_debug_print("as5600: get angle failed.\n");
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if (a_as5600_sim_check("raw angle", (uint8_t)((raw == set) && (angle == set))) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* start and stop position scaling */
+    as5600_interface_debug_print("as5600: start and stop position scaling test.\n");
+    res = as5600_set_start_position(&gs_handle, 1000);
+    res |= as5600_set_stop_position(&gs_handle, 3000);
+    as5600_sim_set_raw_angle(&gs_sim, 2000);
+    res |= as5600_get_angle(&gs_handle, &angle);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: set position failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("stop position scaling", (uint8_t)(angle == 2048)) != 0)
+    {
+        return 1;
+    }
+    as5600_sim_set_raw_angle(&gs_sim, 3500);
+    (void)as5600_get_angle(&gs_handle, &angle);
+    if (a_as5600_sim_check("clamp to the stop position", (uint8_t)(angle == 4095)) != 0)
+    {
+        return 1;
+    }
+    as5600_sim_set_raw_angle(&gs_sim, 900);
+    (void)as5600_get_angle(&gs_handle, &angle);
+    if (a_as5600_sim_check("clamp to the start position", (uint8_t)(angle == 0)) != 0)
+    {
+        return 1;
+    }
+    
+    /* max angle scaling */
+    as5600_interface_debug_print("as5600: max angle scaling test.\n");
+    res = as5600_set_max_angle(&gs_handle, 1024);
+    as5600_sim_set_raw_angle(&gs_sim, 1512);
+    res |= as5600_get_angle(&gs_handle, &angle);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: set max angle failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("max angle scaling", (uint8_t)(angle == 2048)) != 0)
+    {
+        return 1;
+    }
+    
+    /* conf fields */
+    as5600_interface_debug_print("as5600: conf fields test.\n");
+    config.start_position = 0;
+    config.stop_position = 0;
+    config.max_angle = 0;
+    config.watch_dog = AS5600_BOOL_TRUE;
+    config.fast_filter_threshold = AS5600_FAST_FILTER_THRESHOLD_10LSB;
+    config.slow_filter = AS5600_SLOW_FILTER_4X;
+    config.pwm_frequency = AS5600_PWM_FREQUENCY_460HZ;
+    config.output_stage = AS5600_OUTPUT_STAGE_PWM;
+    config.hysteresis = AS5600_HYSTERESIS_2LSB;
+    config.power_mode = AS5600_POWER_MODE_LPM3;
+    res = as5600_apply_config(&gs_handle, &config, AS5600_BOOL_FALSE);
+    res |= as5600_get_config(&gs_handle, &config_check);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: apply config failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("conf fields", (uint8_t)((config_check.watch_dog == config.watch_dog) &&
+                                                    (config_check.fast_filter_threshold == config.fast_filter_threshold) &&
+                                                    (config_check.slow_filter == config.slow_filter) &&
+                                                    (config_check.pwm_frequency == config.pwm_frequency) &&
+                                                    (config_check.output_stage == config.output_stage) &&
+                                                    (config_check.hysteresis == config.hysteresis) &&
+                                                    (config_check.power_mode == config.power_mode))) != 0)
+    {
+        return 1;
+    }
+    reg = 0xFF;
+    res = as5600_set_reg(&gs_handle, 0x07, &reg, 1);
+    res |= as5600_get_reg(&gs_handle, 0x07, &reg, 1);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: set reg failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("conf reserved bits", (uint8_t)(reg == 0x3F)) != 0)
+    {
+        return 1;
+    }
+    gs_sim.reg[0x07] |= 0xC0;
+    gs_sim.reserved = 0;
+    res = as5600_apply_config(&gs_handle, &config, AS5600_BOOL_FALSE);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: apply config failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("apply config keeps reserved bits", (uint8_t)(gs_sim.reserved == 0)) != 0)
+    {
+        return 1;
+    }
+    gs_sim.reg[0x07] &= 0x3F;
+    
+    /* field engine */
+    as5600_interface_debug_print("as5600: as5600_field_set_multiple test.\n");
+    fields[0].field = AS5600_FIELD_WATCH_DOG;
+    fields[0].value = AS5600_BOOL_TRUE;
+    fields[1].field = AS5600_FIELD_SLOW_FILTER;
+    fields[1].value = AS5600_SLOW_FILTER_2X;
+    fields[2].field = AS5600_FIELD_PWM_FREQUENCY;
+    fields[2].value = AS5600_PWM_FREQUENCY_920HZ;
+    fields[3].field = AS5600_FIELD_POWER_MODE;
+    fields[3].value = AS5600_POWER_MODE_LPM1;
+    as5600_sim_clear_counter(&gs_sim);
+    res = as5600_field_set_multiple(&gs_handle, fields, 4);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: field set multiple failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("field set multiple transfers", (uint8_t)(gs_sim.transfers == 2)) != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < 4; i++)
+    {
+        fields[i].value = 0xFFFF;
+    }
+    as5600_sim_clear_counter(&gs_sim);
+    res = as5600_field_get_multiple(&gs_handle, fields, 4);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: field get multiple failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("field get multiple", (uint8_t)((gs_sim.transfers == 1) &&
+                                                           (fields[0].value == AS5600_BOOL_TRUE) &&
+                                                           (fields[1].value == AS5600_SLOW_FILTER_2X) &&
+                                                           (fields[2].value == AS5600_PWM_FREQUENCY_920HZ) &&
+                                                           (fields[3].value == AS5600_POWER_MODE_LPM1))) != 0)
+    {
+        return 1;
+    }
+    res = as5600_field_get(&gs_handle, AS5600_FIELD_HYSTERESIS, &pos);
+    if (a_as5600_sim_check("field kept", (uint8_t)((res == 0) && (pos == config.hysteresis))) != 0)
+    {
+        return 1;
+    }
+    if (a_as5600_sim_check("field rejected", (uint8_t)((as5600_field_set(&gs_handle, AS5600_FIELD_STATUS, 0) == 5) &&
+                                                       (as5600_field_set(&gs_handle, AS5600_FIELD_SLOW_FILTER, 4) == 6) &&
+                                                       (as5600_field_get(&gs_handle, (as5600_field_t)AS5600_FIELD_NUM, &pos) == 4))) != 0)
+    {
+        return 1;
+    }
+    
+    /* output range */
+    as5600_interface_debug_print("as5600: as5600_set_output_range test.\n");
+    as5600_sim_clear_counter(&gs_sim);
+    res = as5600_set_output_range(&gs_handle, 100, 1100, 2000);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: set output range failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("output range transfers", (uint8_t)(gs_sim.transfers == 2)) != 0)
+    {
+        return 1;
+    }
+    res = as5600_get_config(&gs_handle, &config_check);
+    if (a_as5600_sim_check("output range", (uint8_t)((res == 0) && (config_check.start_position == 100) &&
+                                                     (config_check.stop_position == 1100) &&
+                                                     (config_check.max_angle == 2000))) != 0)
+    {
+        return 1;
+    }
+    if (a_as5600_sim_check("output range rejected", (uint8_t)((as5600_set_output_range(&gs_handle, 4000, 100, 0) == 5) &&
+                                                              (as5600_set_output_range(&gs_handle, 0, 0, 204) == 5) &&
+                                                              (as5600_set_output_range(&gs_handle, 0x1000, 0, 0) == 4) &&
+                                                              (as5600_set_output_range(&gs_handle, 3995, 104, 0) == 0))) != 0)
+    {
+        return 1;
+    }
+    
+    /* range aware conversion */
+    as5600_interface_debug_print("as5600: as5600_range_convert_to_fixed test.\n");
+    res = as5600_set_output_range(&gs_handle, 1024, 2048, 0);
+    as5600_sim_set_raw_angle(&gs_sim, 1536);
+    res |= as5600_get_angle(&gs_handle, &angle);
+    res |= as5600_range_convert_to_fixed(&gs_handle, AS5600_FIXED_FORMAT_DEG_Q16, angle, &fixed);
+    if (a_as5600_sim_check("range deg q16", (uint8_t)((res == 0) && (angle == 2048) && (fixed == (135L << 16)))) != 0)
+    {
+        return 1;
+    }
+    (void)as5600_set_start_position(&gs_handle, 1024);
+    if (a_as5600_sim_check("range dropped", (uint8_t)(as5600_range_convert_to_fixed(&gs_handle, AS5600_FIXED_FORMAT_BAM16,
+                                                                                   angle, &fixed) == 5)) != 0)
+    {
+        return 1;
+    }
+    res = as5600_range_load(&gs_handle);
+    res |= as5600_range_convert_to_fixed(&gs_handle, AS5600_FIXED_FORMAT_BAM16, angle, &fixed);
+    if (a_as5600_sim_check("range load", (uint8_t)((res == 0) && (fixed == 0x6000))) != 0)
+    {
+        return 1;
+    }
+#if (AS5600_FLOAT_ENABLE == 1)
+    res = as5600_range_convert_to_data(&gs_handle, 4095, &deg);
+    if (a_as5600_sim_check("range deg", (uint8_t)((res == 0) && (deg > 179.9f) && (deg < 180.0f))) != 0)
+    {
+        return 1;
+    }
+#endif
+    (void)as5600_set_output_range(&gs_handle, 0, 0, 0);
+    
+    /* software zero and direction */
+    as5600_interface_debug_print("as5600: as5600_set_zero_offset test.\n");
+    as5600_sim_set_raw_angle(&gs_sim, 1000);
+    res = as5600_set_zero_offset(&gs_handle, 900);
+    res |= as5600_get_raw_angle(&gs_handle, &raw);
+    if (a_as5600_sim_check("zero offset", (uint8_t)((res == 0) && (raw == 100))) != 0)
+    {
+        return 1;
+    }
+    res = as5600_set_direction_invert(&gs_handle, AS5600_BOOL_TRUE);
+    res |= as5600_get_raw_angle(&gs_handle, &raw);
+    if (a_as5600_sim_check("direction invert", (uint8_t)((res == 0) && (raw == 3996))) != 0)
+    {
+        return 1;
+    }
+    fields[0].field = AS5600_FIELD_RAW_ANGLE;
+    res = as5600_field_get(&gs_handle, AS5600_FIELD_RAW_ANGLE, &pos);
+    res |= as5600_field_get_multiple(&gs_handle, fields, 1);
+    if (a_as5600_sim_check("field raw angle zero", (uint8_t)((res == 0) && (pos == 3996) &&
+                                                             (fields[0].value == 3996))) != 0)
+    {
+        return 1;
+    }
+    as5600_sim_set_raw_angle(&gs_sim, 3000);
+    res = as5600_capture_zero(&gs_handle);
+    res |= as5600_get_zero_offset(&gs_handle, &pos);
+    res |= as5600_get_raw_angle(&gs_handle, &raw);
+    if (a_as5600_sim_check("capture zero", (uint8_t)((res == 0) && (pos == 3000) && (raw == 0))) != 0)
+    {
+        return 1;
+    }
+    as5600_sim_set_raw_angle(&gs_sim, 2990);
+    (void)as5600_get_raw_angle(&gs_handle, &raw);
+    if (a_as5600_sim_check("inverted step", (uint8_t)((raw == 10) &&
+                                                      (as5600_set_zero_offset(&gs_handle, 0x1000) == 4))) != 0)
+    {
+        return 1;
+    }
+    (void)as5600_set_direction_invert(&gs_handle, AS5600_BOOL_FALSE);
+    (void)as5600_set_zero_offset(&gs_handle, 0);
+    
+    /* tear free verification */
+    as5600_interface_debug_print("as5600: as5600_set_verify test.\n");
+    as5600_sim_set_raw_angle(&gs_sim, 1000);
+#if (AS5600_STATS_ENABLE == 1)
+    (void)as5600_clear_stats(&gs_handle);
+#endif
+    res = as5600_set_verify(&gs_handle, AS5600_BOOL_TRUE);
+    res |= as5600_get_raw_angle(&gs_handle, &raw);
+    as5600_sim_clear_counter(&gs_sim);
+    res |= as5600_get_raw_angle(&gs_handle, &raw);
+    if (a_as5600_sim_check("verify clean read", (uint8_t)((res == 0) && (raw == 1000) && (gs_sim.transfers == 1))) != 0)
+    {
+        return 1;
+    }
+    as5600_sim_set_glitch(&gs_sim, 0x80);
+    res = as5600_get_raw_angle(&gs_handle, &raw);
+    as5600_sim_set_glitch(&gs_sim, 0x08);
+    res |= as5600_get_raw_angle(&gs_handle, &raw);
+    as5600_sim_set_glitch(&gs_sim, 0x40);
+    res |= as5600_get_magnitude(&gs_handle, &magnitude);
+    res |= as5600_get_verify_count(&gs_handle, &before, &after);
+    if (a_as5600_sim_check("verify torn read", (uint8_t)((res == 0) && (raw == 1000) && (magnitude == 2048) &&
+                                                         (before == 2) && (after == 1))) != 0)
+    {
+        return 1;
+    }
+    as5600_sim_set_raw_angle(&gs_sim, 3100);
+    res = as5600_get_raw_angle(&gs_handle, &raw);
+    as5600_sim_clear_counter(&gs_sim);
+    res |= as5600_get_raw_angle(&gs_handle, &raw);
+    res |= as5600_get_verify_count(&gs_handle, &before, &after);
+    if (a_as5600_sim_check("verify real move", (uint8_t)((res == 0) && (raw == 3100) && (after == 2) &&
+                                                         (gs_sim.transfers == 1))) != 0)
+    {
+        return 1;
+    }
+#if (AS5600_STATS_ENABLE == 1)
+    (void)as5600_get_stats(&gs_handle, &stats);
+    if (a_as5600_sim_check("verify retries", (uint8_t)(stats.retries == 4)) != 0)
+    {
+        return 1;
+    }
+#endif
+    gs_sim.reg[0x0C] |= 0x80;
+    if (a_as5600_sim_check("verify reserved bits", (uint8_t)((as5600_get_raw_angle(&gs_handle, &raw) == 1) &&
+                                                             (as5600_set_verify_max_step(&gs_handle, 0) == 4))) != 0)
+    {
+        return 1;
+    }
+    as5600_sim_set_raw_angle(&gs_sim, 3100);
+    (void)as5600_get_angle(&gs_handle, &angle);
+    (void)as5600_get_verify_count(&gs_handle, &before, &after);
+    as5600_sim_set_glitch(&gs_sim, 0x80);
+    res = as5600_get_angle(&gs_handle, &pos);
+    res |= as5600_start_poll_read(&gs_handle, AS5600_POLL_REGISTER_RAW_ANGLE);
+    as5600_sim_set_glitch(&gs_sim, 0x80);
+    res |= as5600_poll_read(&gs_handle, &raw);
+    (void)as5600_stop_poll_read(&gs_handle);
+    as5600_sim_set_glitch(&gs_sim, 0x80);
+    res |= as5600_read_burst(&gs_handle, data, 4);
+    res |= as5600_get_verify_count(&gs_handle, &count, &after);
+    if (a_as5600_sim_check("verify angle, poll and burst", (uint8_t)((res == 0) && (pos == angle) && (raw == 3100) &&
+                                                                     (data[0] == 3100) && (data[3] == 3100) &&
+                                                                     (count == before + 3))) != 0)
+    {
+        return 1;
+    }
+    DRIVER_AS5600_LINK_IIC_READ_ASYNC(&gs_handle, a_as5600_sim_read_async);
+    as5600_sim_set_glitch(&gs_sim, 0x80);
+    res = as5600_read_start(&gs_handle);
+    res |= (uint8_t)(as5600_read_poll(&gs_handle, &raw) != 1);
+    res |= as5600_read_start(&gs_handle);
+    res |= as5600_read_poll(&gs_handle, &raw);
+    res |= as5600_get_verify_count(&gs_handle, &count, &after);
+    DRIVER_AS5600_LINK_IIC_READ_ASYNC(&gs_handle, NULL);
+    if (a_as5600_sim_check("verify async read", (uint8_t)((res == 0) && (raw == 3100) && (count == before + 4))) != 0)
+    {
+        return 1;
+    }
+    (void)as5600_set_verify(&gs_handle, AS5600_BOOL_FALSE);
+    
+    /* unwrap array */
+    as5600_interface_debug_print("as5600: as5600_angle_unwrap_array test.\n");
+    data[0] = 4000;
+    data[1] = 10;
+    data[2] = 2000;
+    data[3] = 4000;
+    data[4] = 100;
+    last_raw = data[0];
+    position = data[0];
+    res = as5600_angle_unwrap_array(&gs_handle, &data[0], &unwrap[0], 2, &last_raw, &position);
+    res |= as5600_angle_unwrap_array(&gs_handle, &data[2], &unwrap[2], 3, &last_raw, &position);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: angle unwrap array failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("unwrap chained blocks", (uint8_t)((unwrap[0] == 4000) && (unwrap[1] == 4106) &&
+                                                              (unwrap[2] == 6096) && (unwrap[3] == 8096) &&
+                                                              (unwrap[4] == 8292) && (position == 8292) &&
+                                                              (last_raw == 100))) != 0)
+    {
+        return 1;
+    }
+    position = (int64_t)1 << 40;
+    res = as5600_angle_unwrap_array(&gs_handle, &data[0], &unwrap[0], 5, &last_raw, &position);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: angle unwrap array failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("unwrap 64 bit position", (uint8_t)((unwrap[0] == ((int64_t)1 << 40) - 196) &&
+                                                               (position == ((int64_t)1 << 40) + 4096))) != 0)
+    {
+        return 1;
+    }
+    
+    /* status, agc and magnitude */
+    as5600_interface_debug_print("as5600: status, agc and magnitude test.\n");
+    as5600_sim_set_magnet(&gs_sim, 1, 255, 100);
+    res = as5600_get_status(&gs_handle, &status);
+    res |= as5600_get_agc(&gs_handle, &agc);
+    res |= as5600_get_magnitude(&gs_handle, &magnitude);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: get status failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("weak magnet", (uint8_t)((status == (AS5600_STATUS_MD | AS5600_STATUS_ML)) &&
+                                                    (agc == 255) && (magnitude == 100))) != 0)
+    {
+        return 1;
+    }
+    as5600_sim_set_magnet(&gs_sim, 1, 0, 4000);
+    (void)as5600_get_status(&gs_handle, &status);
+    if (a_as5600_sim_check("strong magnet", (uint8_t)(status == (AS5600_STATUS_MD | AS5600_STATUS_MH))) != 0)
+    {
+        return 1;
+    }
+    as5600_sim_set_magnet(&gs_sim, 1, 128, 2048);
+    
+    /* snapshot */
+    as5600_interface_debug_print("as5600: as5600_read_snapshot test.\n");
+    (void)as5600_set_max_angle(&gs_handle, 0);
+    (void)as5600_set_stop_position(&gs_handle, 0);
+    (void)as5600_set_start_position(&gs_handle, 0);
+    as5600_sim_set_raw_angle(&gs_sim, 1234);
+    res = as5600_read_snapshot(&gs_handle, AS5600_BOOL_TRUE, &snapshot);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: read snapshot failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("snapshot", (uint8_t)((snapshot.status == AS5600_STATUS_MD) && (snapshot.raw_angle == 1234) &&
+                                                 (snapshot.angle == 1234) && (snapshot.agc == 128) &&
+                                                 (snapshot.magnitude == 2048))) != 0)
+    {
+        return 1;
+    }
+    
+    /* poll read keeps the address pointer */
+    as5600_interface_debug_print("as5600: as5600_poll_read test.\n");
+    res = as5600_start_poll_read(&gs_handle, AS5600_POLL_REGISTER_RAW_ANGLE);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: start poll read failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (i = 0; i < times; i++)
+    {
+        uint16_t set = (uint16_t)(rand() % 4096);
+        
+        as5600_sim_set_raw_angle(&gs_sim, set);
+        as5600_sim_clear_counter(&gs_sim);
+        res = as5600_poll_read(&gs_handle, &raw);
+        msgs = gs_sim.msgs;
+        if (res != 0)
+        {
+            as5600_interface_debug_print("as5600: poll read failed.\n");
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if (a_as5600_sim_check("poll read", (uint8_t)((raw == set) && (msgs == 1))) != 0)
+        {
+            return 1;
+        }
+    }
+    (void)as5600_stop_poll_read(&gs_handle);
+    
+    /* burst read */
+    as5600_interface_debug_print("as5600: as5600_read_burst test.\n");
+    as5600_sim_set_raw_angle(&gs_sim, 4000);
+    res = as5600_read_burst(&gs_handle, data, 16);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: read burst failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (i = 0; i < 16; i++)
+    {
+        if (data[i] != 4000)
+        {
+            break;
+        }
+    }
+    if (a_as5600_sim_check("burst read", (uint8_t)(i == 16)) != 0)
+    {
+        return 1;
+    }
+    
+    /* bus timing */
+    as5600_interface_debug_print("as5600: as5600_sim_get_wire_time test.\n");
+    as5600_sim_clear_counter(&gs_sim);
+    (void)as5600_get_raw_angle(&gs_handle, &raw);
+    as5600_sim_timing_init(&timing, 100000);
+    if (a_as5600_sim_check("standard mode wire time", (uint8_t)(as5600_sim_get_wire_time(&gs_sim, &timing) == 471400)) != 0)
+    {
+        return 1;
+    }
+    as5600_sim_timing_init(&timing, 400000);
+    if (a_as5600_sim_check("fast mode wire time", (uint8_t)(as5600_sim_get_wire_time(&gs_sim, &timing) == 116200)) != 0)
+    {
+        return 1;
+    }
+    as5600_sim_timing_init(&timing, 1000000);
+    timing.t_stretch_ns = 100;
+    if (a_as5600_sim_check("fast mode plus wire time", (uint8_t)(as5600_sim_get_wire_time(&gs_sim, &timing) == 47040)) != 0)
+    {
+        return 1;
+    }
+    
+    /* sample timestamp */
+    as5600_interface_debug_print("as5600: as5600_get_sample_timestamp test.\n");
+    before = as5600_interface_timestamp_us();
+    (void)as5600_get_raw_angle(&gs_handle, &raw);
+    after = as5600_interface_timestamp_us();
+    res = as5600_get_sample_timestamp(&gs_handle, &stamp);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: get sample timestamp failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_as5600_sim_check("sample timestamp", (uint8_t)((stamp - before) <= (after - before))) != 0)
+    {
+        return 1;
+    }
+    
+    /* sample ring */
+    as5600_interface_debug_print("as5600: as5600_ring_sample test.\n");
+    if (a_as5600_sim_check("ring size", (uint8_t)(as5600_ring_init(&ring, ring_buf, 3) == 4)) != 0)
+    {
+        return 1;
+    }
+    (void)as5600_ring_init(&ring, ring_buf, 4);
+    (void)as5600_get_status(&gs_handle, &status);
+    for (i = 0; i < 6; i++)
+    {
+        as5600_sim_set_raw_angle(&gs_sim, (uint16_t)(100 * i));
+        res = as5600_ring_sample(&gs_handle, &ring);
+        if ((res != 0) && (res != 4))
+        {
+            as5600_interface_debug_print("as5600: ring sample failed.\n");
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    (void)as5600_ring_get_count(&ring, &count, &dropped);
+    if (a_as5600_sim_check("ring overflow", (uint8_t)((count == 4) && (dropped == 2))) != 0)
+    {
+        return 1;
+    }
+    stamp = 0;
+    for (i = 0; as5600_ring_pop(&ring, &sample) == 0; i++)
+    {
+        if ((sample.raw_angle != (100 * i)) || (sample.status != status) || (sample.sequence != i) ||
+            ((i != 0) && ((int32_t)(sample.timestamp_us - stamp) < 0)))
+        {
+            break;
+        }
+        stamp = sample.timestamp_us;
+    }
+    if (a_as5600_sim_check("ring order", (uint8_t)(i == 4)) != 0)
+    {
+        return 1;
+    }
+    (void)as5600_ring_sample(&gs_handle, &ring);
+    (void)as5600_ring_pop(&ring, &sample);
+    if (a_as5600_sim_check("ring sequence skips the dropped samples", (uint8_t)(sample.sequence == 6)) != 0)
+    {
+        return 1;
+    }
+    
+    /* stream frame */
+    as5600_interface_debug_print("as5600: as5600_stream_encode test.\n");
+    sample.timestamp_us = 0x89ABCDEF;
+    sample.raw_angle = 0xABC;
+    sample.status = AS5600_STATUS_MD | AS5600_STATUS_ML;
+    (void)as5600_stream_encode(&sample, 0x1234, frame);
+    res = as5600_stream_decode(frame, &sequence, &decoded);
+    if (a_as5600_sim_check("stream frame", (uint8_t)((res == 0) && (sequence == 0x1234) && (decoded.sequence == 0x1234) &&
+                                                     (decoded.timestamp_us == sample.timestamp_us) &&
+                                                     (decoded.raw_angle == sample.raw_angle) &&
+                                                     (decoded.status == sample.status))) != 0)
+    {
+        return 1;
+    }
+    frame[6] ^= 0x01;
+    if (a_as5600_sim_check("stream frame crc", (uint8_t)(as5600_stream_decode(frame, &sequence, &decoded) == 5)) != 0)
+    {
+        return 1;
+    }
+    
+#if (AS5600_STATS_ENABLE == 1)
+    /* stats */
+    as5600_interface_debug_print("as5600: as5600_get_stats test.\n");
+    (void)as5600_clear_stats(&gs_handle);
+    (void)as5600_read_snapshot(&gs_handle, AS5600_BOOL_TRUE, &snapshot);
+    (void)as5600_set_start_position(&gs_handle, 0);
+    res = as5600_get_stats(&gs_handle, &stats);
+    if (res != 0)
+    {
+        as5600_interface_debug_print("as5600: get stats failed.\n");
+        (void)as5600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    msgs = 0;
+    for (i = 0; i < AS5600_STATS_HISTOGRAM_NUM; i++)
+    {
+        msgs += stats.histogram[i];
+    }
+    if (a_as5600_sim_check("stats counters", (uint8_t)((stats.transactions == 3) && (stats.bytes == 10) &&
+                                                       (stats.failures == 0) && (msgs == 2))) != 0)
+    {
+        return 1;
+    }
+    if (a_as5600_sim_check("stats api", (uint8_t)((stats.latency[AS5600_STATS_API_READ_SNAPSHOT].count == 1) &&
+                                                  (stats.latency[AS5600_STATS_API_FIELD_SET].count == 1) &&
+                                                  (stats.latency[AS5600_STATS_API_REGISTER].count == 0) &&
+                                                  (stats.latency[AS5600_STATS_API_READ_SNAPSHOT].min_us <=
+                                                   stats.latency[AS5600_STATS_API_READ_SNAPSHOT].max_us))) != 0)
+    {
+        return 1;
+    }
+    as5600_interface_debug_print("as5600: snapshot call latency is %d us to %d us.\n",
+                                 (int)stats.latency[AS5600_STATS_API_READ_SNAPSHOT].min_us,
+                                 (int)stats.latency[AS5600_STATS_API_READ_SNAPSHOT].max_us);
+#endif
+    
+    /* burn counter */
+    as5600_interface_debug_print("as5600: as5600_set_burn test.\n");
+    (void)as5600_set_start_position(&gs_handle, 100);
+    for (i = 0; i < 4; i++)
+    {
+        res = as5600_set_burn(&gs_handle, AS5600_BURN_ANGLE);
+        if (res != 0)
+        {
+            as5600_interface_debug_print("as5600: set burn failed.\n");
+            (void)as5600_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    (void)as5600_get_reg(&gs_handle, 0x00, &zmco, 1);
+    if (a_as5600_sim_check("burn counter", (uint8_t)(zmco == 3)) != 0)
+    {
+        return 1;
+    }
+    (void)as5600_set_start_position(&gs_handle, 200);
+    (void)as5600_set_burn(&gs_handle, AS5600_BURN_CMD1);
+    (void)as5600_set_burn(&gs_handle, AS5600_BURN_CMD2);
+    (void)as5600_set_burn(&gs_handle, AS5600_BURN_CMD3);
+    (void)as5600_get_start_position(&gs_handle, &pos);
+    if (a_as5600_sim_check("load otp", (uint8_t)(pos == 100)) != 0)
+    {
+        return 1;
+    }
+    
+    /* finish sim test */
+    as5600_interface_debug_print("as5600: finish sim test.\n");
+    (void)as5600_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_as5600_stream_decode.c
+ * @brief     driver as5600 stream decode source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2022-09-30
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2022/09/30  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_as5600.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief decode buffer size definition
+ */
+#define DECODE_BUFFER_SIZE 4096        /**< bytes read at once */
+
+/**
+ * @brief     stream decode main
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 decode failed
+ * @note      usage: driver_as5600_stream_decode <stream file | -> [csv file],
+ *            the frames are written as csv rows and the bytes between the frames are skipped,
+ *            the lost column counts the frames missing from the sequence before each row
+ */
+int main(int argc, char **argv)
+{
+    static uint8_t buf[DECODE_BUFFER_SIZE + AS5600_STREAM_FRAME_SIZE];
+    FILE *in;
+    FILE *out;
+    size_t len;
+    size_t pos;
+    size_t n;
+    uint16_t sequence;
+    uint16_t last;
+    uint32_t lost;
+    uint64_t frames;
+    uint64_t lost_total;
+    uint64_t skipped;
+    as5600_sample_t sample;
+    
+    if (argc < 2)
+    {
+        (void)fprintf(stderr, "usage: driver_as5600_stream_decode <stream file | -> [csv file]\n");
+        
+        return 1;
+    }
+    
+    /* open the files */
+    in = (strcmp(argv[1], "-") == 0) ? stdin : fopen(argv[1], "rb");
+    if (in == NULL)
+    {
+        (void)fprintf(stderr, "as5600: open %s failed.\n", argv[1]);
+        
+        return 1;
+    }
+    out = (argc > 2) ? fopen(argv[2], "w") : stdout;
+    if (out == NULL)
+    {
+        (void)fprintf(stderr, "as5600: open %s failed.\n", argv[2]);
+        if (in != stdin)
+        {
+            (void)fclose(in);
+        }
+        
+        return 1;
+    }
+    
+    /* decode */
+    (void)fprintf(out, "sequence,timestamp_us,raw_angle,angle_deg,md,ml,mh,lost\n");
+    frames = 0;
+    lost_total = 0;
+    skipped = 0;
+    last = 0;
+    len = 0;
+    while (1)
+    {
+        n = fread(buf + len, 1, DECODE_BUFFER_SIZE + AS5600_STREAM_FRAME_SIZE - len, in);
+        len += n;
+        pos = 0;
+        while ((len - pos) >= AS5600_STREAM_FRAME_SIZE)
+        {
+            if (as5600_stream_decode(buf + pos, &sequence, &sample) != 0)
+            {
+                /* lost the sync, move on by one byte */
+                pos++;
+                skipped++;
+                
+                continue;
+            }
+            lost = (frames != 0) ? (uint16_t)(sequence - last - 1) : 0;
+            lost_total += lost;
+            last = sequence;
+            frames++;
+            (void)fprintf(out, "%u,%u,%u,%.3f,%u,%u,%u,%u\n", (unsigned int)sequence, (unsigned int)sample.timestamp_us,
+                          (unsigned int)sample.raw_angle, (double)sample.raw_angle * 360.0 / 4096.0,
+                          (unsigned int)((sample.status & AS5600_STATUS_MD) != 0), (unsigned int)((sample.status & AS5600_STATUS_ML) != 0),
+                          (unsigned int)((sample.status & AS5600_STATUS_MH) != 0), (unsigned int)lost);
+            pos += AS5600_STREAM_FRAME_SIZE;
+        }
+        
+        /* keep the tail for the next read */
+        memmove(buf, buf + pos, len - pos);
+        len -= pos;
+        if (n == 0)
+        {
+            break;
+        }
+    }
+    skipped += len;
+    
+    /* close the files */
+    if (in != stdin)
+    {
+        (void)fclose(in);
+    }
+    if (out != stdout)
+    {
+        (void)fclose(out);
+    }
+    (void)fprintf(stderr, "as5600: %llu frames, %llu lost frames and %llu skipped bytes.\n",
+                  (unsigned long long)frames, (unsigned long long)lost_total, (unsigned long long)skipped);
+    
+    return (frames != 0) ? 0 : 1;
+}